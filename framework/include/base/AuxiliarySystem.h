@@ -116,6 +116,12 @@ public:
    */
   virtual void compute(ExecFlagType type);
 
+  /**
+   * Whether any auxiliary variable is computed for the given time flag
+   * @param type Time flag of which variables should be computed
+   */
+  bool hasActiveObjects(ExecFlagType type) const;
+
   /**
    * Get a list of dependent UserObjects for this exec type
    * @param type Execution flag type
@@ -0,0 +1,73 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEFDJACOBIANTHREAD_H
+#define COMPUTEFDJACOBIANTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+// libMesh includes
+#include "libmesh/dense_vector.h"
+
+// Forward declarations
+class FEProblemBase;
+class KernelBase;
+
+/**
+ * Computes the element Jacobian blocks of the Kernels by finite differencing the element residual.
+ *
+ * Every dof of the current element is perturbed in turn, the materials and the Kernels of the
+ * current element are re-evaluated, and the difference to the unperturbed element residual gives
+ * one column of each coupled Jacobian block. The cost therefore scales with the number of
+ * elements rather than with the number of colors times the whole mesh. TimeKernels, boundary
+ * and interface contributions are still computed from their hand-coded Jacobians.
+ */
+class ComputeFDJacobianThread : public ComputeFullJacobianThread
+{
+public:
+  ComputeFDJacobianThread(FEProblemBase & fe_problem,
+                          SparseMatrix<Number> & jacobian,
+                          Moose::KernelType kernel_type = Moose::KT_ALL);
+
+  // Splitting Constructor
+  ComputeFDJacobianThread(ComputeFDJacobianThread & x, Threads::split split);
+
+  virtual ~ComputeFDJacobianThread();
+
+  void join(const ComputeJacobianThread & /*y*/) {}
+
+protected:
+  virtual void computeJacobian() override;
+
+  /**
+   * Evaluate the residual of the finite differenced Kernels of a variable on the current element
+   * @param ivar The number of the variable
+   * @param re The element residual (output)
+   */
+  void computeElemResidual(unsigned int ivar, DenseVector<Number> & re);
+
+  /// Returns true if the Jacobian of this Kernel is obtained by finite differencing
+  bool isFiniteDifferenced(const KernelBase & kernel) const;
+
+  /// Relative size of the perturbation
+  Real _perturbation_scale;
+
+  /// Unperturbed element residuals, indexed by variable number
+  std::vector<DenseVector<Number>> _residual;
+
+  /// Perturbed element residual
+  DenseVector<Number> _perturbed_residual;
+};
+
+#endif // COMPUTEFDJACOBIANTHREAD_H
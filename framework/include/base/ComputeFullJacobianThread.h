@@ -41,6 +41,12 @@ protected:
   virtual void computeInternalFaceJacobian(const Elem * neighbor) override;
   virtual void computeInternalInterFaceJacobian(BoundaryID bnd_id) override;
 
+  /// Computes the off-diagonal blocks of the nonlocal kernels
+  void computeNonlocalJacobian();
+
+  /// Computes the off-diagonal blocks of the kernels with respect to coupled scalar variables
+  void computeScalarJacobian();
+
   NonlinearSystemBase & _nl;
 
   // Reference to BC storage structures
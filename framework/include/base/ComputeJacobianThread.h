@@ -20,6 +20,8 @@
 // libMesh includes
 #include "libmesh/elem_range.h"
 
+#include <chrono>
+
 // Forward declarations
 class FEProblemBase;
 class NonlinearSystemBase;
@@ -45,7 +47,7 @@ public:
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
   virtual void onInterface(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
-  virtual void postElement(const Elem * /*elem*/) override;
+  virtual void postElement(const Elem * elem) override;
   virtual void post() override;
 
   void join(const ComputeJacobianThread & /*y*/);
@@ -56,6 +58,9 @@ protected:
 
   unsigned int _num_cached;
 
+  /// Start of the assembly of the current element, for measuring the element costs
+  std::chrono::steady_clock::time_point _elem_start;
+
   // Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
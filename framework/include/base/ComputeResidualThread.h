@@ -20,6 +20,8 @@
 // libMesh includes
 #include "libmesh/elem_range.h"
 
+#include <chrono>
+
 // Forward declarations
 class FEProblemBase;
 class NonlinearSystemBase;
@@ -44,7 +46,7 @@ public:
   virtual void onBoundary(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInterface(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
-  virtual void postElement(const Elem * /*elem*/) override;
+  virtual void postElement(const Elem * elem) override;
   virtual void post() override;
 
   void join(const ComputeResidualThread & /*y*/);
@@ -54,6 +56,9 @@ protected:
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
 
+  /// Start of the assembly of the current element, for measuring the element costs
+  std::chrono::steady_clock::time_point _elem_start;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBC> & _integrated_bcs;
 
@@ -32,6 +32,7 @@
 #include "MooseVariableBase.h"
 #include "MultiAppTransfer.h"
 #include "Postprocessor.h"
+#include "LayeredBase.h"
 
 // libMesh includes
 #include "libmesh/enum_quadrature_type.h"
@@ -1088,6 +1089,12 @@ public:
   /// Update the mesh due to changing XFEM cuts
   virtual bool updateMeshXFEM();
 
+  /**
+   * Repartition the mesh if it uses a CostWeightedPartitioner and the measured cost of the
+   * processors is out of balance. The stateful material properties follow their elements.
+   */
+  virtual void rebalanceMesh();
+
   virtual void meshChanged() override;
 
   /**
@@ -1574,6 +1581,17 @@ FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
         objects[i]->threadJoin(*(other_objects[i]));
     }
 
+    // Sum the layers of all of the layered objects in a single reduction
+    std::vector<LayeredBase *> layered_objects;
+    for (auto & object : objects)
+    {
+      LayeredBase * layered_object = dynamic_cast<LayeredBase *>(object.get());
+      if (layered_object)
+        layered_objects.push_back(layered_object);
+    }
+    if (!layered_objects.empty())
+      LayeredBase::sumLayers(layered_objects, _communicator);
+
     // Finalize them and save off PP values
     for (auto & object : objects)
     {
@@ -428,6 +428,28 @@ protected:
    */
   void getDofIndices(const Elem * elem, std::vector<dof_id_type> & dof_indices);
 
+  /**
+   * Compute the needed values, gradients and second derivatives at the quadrature points of the
+   * current element (or side) from the given shape functions
+   * @param nqp Number of quadrature points
+   * @param phi Shape function values
+   * @param grad_phi Shape function gradients
+   * @param second_phi Shape function second derivatives (only used if they are needed)
+   */
+  void computeValuesInternal(unsigned int nqp,
+                             const VariablePhiValue & phi,
+                             const VariablePhiGradient & grad_phi,
+                             const VariablePhiSecond * second_phi);
+
+  /**
+   * Compute the needed neighbor values, gradients and second derivatives from the given shape
+   * functions, see computeValuesInternal()
+   */
+  void computeNeighborValuesInternal(unsigned int nqp,
+                                     const VariablePhiValue & phi,
+                                     const VariablePhiGradient & grad_phi,
+                                     const VariablePhiSecond * second_phi);
+
 protected:
   /// Thread ID
   THREAD_ID _tid;
@@ -450,6 +472,15 @@ protected:
   /// DOF indices (neighbor)
   std::vector<dof_id_type> _dof_indices_neighbor;
 
+  ///@{
+  /// Solution values gathered at the dofs of the current element (or neighbor)
+  std::vector<Real> _dof_values;
+  std::vector<Real> _dof_values_old;
+  std::vector<Real> _dof_values_older;
+  std::vector<Real> _dof_values_previous_nl;
+  std::vector<Real> _dof_values_dot;
+  ///@}
+
   bool _need_u_old;
   bool _need_u_older;
   bool _need_u_previous_nl;
@@ -237,6 +237,12 @@ public:
    */
   void computeResidual(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_ALL);
 
+  /**
+   * Enforces nodal boundary conditions
+   * @param residual Residual where nodal BCs are enforced (input/output)
+   */
+  void computeNodalBCs(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_ALL);
+
   /**
    * Finds the implicit sparsity graph between geometrically related dofs.
    */
@@ -354,6 +360,15 @@ public:
     _use_finite_differenced_preconditioner = use;
   }
 
+  /**
+   * If called with true the element Jacobian blocks of the Kernels are computed by
+   * finite differencing the element residual (see ComputeFDJacobianThread)
+   */
+  void useFiniteDifferencedElementJacobian(bool use = true)
+  {
+    _use_finite_differenced_element_jacobian = use;
+  }
+
   /**
    * If called with a single string, it is used as the name of a the top-level decomposition split.
    * If the array is empty, no decomposition is used.
@@ -545,12 +560,6 @@ protected:
    */
   void computeResidualInternal(Moose::KernelType type = Moose::KT_ALL);
 
-  /**
-   * Enforces nodal boundary conditions
-   * @param residual Residual where nodal BCs are enforced (input/output)
-   */
-  void computeNodalBCs(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_ALL);
-
   void computeJacobianInternal(SparseMatrix<Number> & jacobian, Moose::KernelType kernel_type);
 
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
@@ -643,6 +652,8 @@ protected:
 
   /// Whether or not to use a finite differenced preconditioner
   bool _use_finite_differenced_preconditioner;
+  /// Whether or not to finite difference the Kernel Jacobians element by element
+  bool _use_finite_differenced_element_jacobian;
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
 #endif
@@ -34,6 +34,7 @@ class MooseApp;
 class MooseVariable;
 class MooseMesh;
 class SubProblem;
+class DistributedExodusReader;
 class SystemBase;
 
 // libMesh forward declarations
@@ -468,6 +469,9 @@ public:
 
   void copyVars(ExodusII_IO & io);
 
+  /// Copy the variables from a mesh file read in parallel
+  void copyVars(DistributedExodusReader & reader);
+
   /**
    * Copy current solution into old and older
    */
@@ -102,6 +102,11 @@ public:
    */
   virtual bool update(Real time, NonlinearSystemBase & nl, AuxiliarySystem & aux) = 0;
 
+  /**
+   * Called after every change of the mesh, including the changes made by update()
+   */
+  virtual void meshChanged() {}
+
   /**
    * Initialize the solution on newly created nodes
    */
@@ -23,6 +23,7 @@
 // Forward Declarations
 class FaceFaceConstraint;
 class FEProblemBase;
+class PenetrationInfo;
 
 template <>
 InputParameters validParams<FaceFaceConstraint>();
@@ -41,6 +42,10 @@ InputParameters validParams<FaceFaceConstraint>();
  * lambda  | MasterMaster | MasterSlave |             |
  *         +--------------+-------------+-------------+
  *
+ * The quadrature points of an element of the interface are grouped into segments, a segment being
+ * the part of the element that projects onto one pair of master and slave elements. The segments
+ * are built once per configuration (i.e. whenever the penetration search has been redone) and
+ * the master and slave side contributions are assembled segment by segment.
  */
 class FaceFaceConstraint : public Constraint,
                            public CoupleableMooseVariableDependencyIntermediateInterface
@@ -52,14 +57,26 @@ public:
    * Evaluate variables, compute q-points, etc.
    */
   virtual void reinit();
-  virtual void reinitSide(Moose::ConstraintType res_type);
+
+  /**
+   * Number of segments of the current element of the interface, valid after reinit()
+   */
+  unsigned int numSegments() const { return _current_segments_end - _current_segments_begin; }
+
+  /**
+   * Reinit the master or slave element of a segment of the current element at the quadrature
+   * points of that segment
+   * @param res_type Master or slave side
+   * @param segment Index of the segment, must be less than numSegments()
+   */
+  virtual void reinitSide(Moose::ConstraintType res_type, unsigned int segment);
 
   /**
    * Computes the residual for the current element.
    */
   virtual void computeResidual();
   /**
-   * Computes residual contributions from master or slave side
+   * Computes residual contributions from master or slave side of the current segment
    * @param side Master or slave side
    */
   virtual void computeResidualSide(Moose::ConstraintType side);
@@ -69,7 +86,7 @@ public:
    */
   virtual void computeJacobian();
   /**
-   * Computes Jacobian contributions from master or slave side
+   * Computes Jacobian contributions from master or slave side of the current segment
    * @param side Master or slave side
    */
   virtual void computeJacobianSide(Moose::ConstraintType side);
@@ -80,6 +97,27 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpJacobianSide(Moose::ConstraintJacobianType jac_type);
 
+  /// Part of an element of the interface that projects onto one pair of master and slave elements
+  struct Segment
+  {
+    const Elem * _elem_master;
+    const Elem * _elem_slave;
+
+    /// Sides the variables are evaluated on
+    std::unique_ptr<const Elem> _side_master;
+    std::unique_ptr<const Elem> _side_slave;
+
+    /// Range of the quadrature points of this segment in the _segment_* vectors
+    unsigned int _begin;
+    unsigned int _end;
+  };
+
+  /**
+   * Build the segments of the current element of the interface
+   * @param nqp The number of quadrature points on the element
+   */
+  void buildSegments(unsigned int nqp);
+
   FEProblemBase & _fe_problem;
   unsigned int _dim;
 
@@ -115,6 +153,34 @@ protected:
   PenetrationLocator & _master_penetration_locator;
   PenetrationLocator & _slave_penetration_locator;
 
+  /// Segments of all elements of the interface visited since the last search
+  std::vector<Segment> _segments;
+
+  /// Range of the segments of each element of the interface in _segments
+  std::map<dof_id_type, std::pair<unsigned int, unsigned int>> _elem_segments;
+
+  ///@{ Data of the quadrature points of all segments stored contiguously
+  std::vector<unsigned int> _segment_qps;
+  std::vector<const PenetrationInfo *> _segment_master_pinfos;
+  std::vector<const PenetrationInfo *> _segment_slave_pinfos;
+  std::vector<Point> _segment_ref_points_master;
+  std::vector<Point> _segment_ref_points_slave;
+  ///@}
+
+  ///@{ Search counts of the penetration locators the segments were built for
+  unsigned int _master_search_count;
+  unsigned int _slave_search_count;
+  ///@}
+
+  ///@{ Segments of the current element and the current segment
+  unsigned int _current_segments_begin;
+  unsigned int _current_segments_end;
+  unsigned int _current_segment;
+  ///@}
+
+  /// Reference points the master or slave element is reinited at
+  std::vector<Point> _side_ref_points;
+
   /**
    * Values of the constrained variable on the master side
    */
@@ -126,7 +192,7 @@ protected:
    */
   std::vector<Point> _phys_points_master;
   /**
-   * Element on the master side
+   * Element on the master side of the current segment
    */
   const Elem * _elem_master;
   /**
@@ -151,7 +217,7 @@ protected:
    */
   std::vector<Point> _phys_points_slave;
   /**
-   * Element on the master side
+   * Element on the slave side of the current segment
    */
   const Elem * _elem_slave;
   /**
@@ -23,6 +23,7 @@
 #include "libmesh/vector_value.h"
 #include "libmesh/point.h"
 #include "libmesh/fe_base.h"
+#include "libmesh/elem.h"
 
 // Forward Declarations
 class SubProblem;
@@ -49,6 +50,12 @@ public:
    */
   void reinit();
 
+  /**
+   * Drop the cached master boundary sides and node positions, they are rebuilt by the next
+   * search. Must be called whenever the mesh topology changes.
+   */
+  void clearMasterSides();
+
   Real penetrationDistance(dof_id_type node_id);
   RealVectorValue penetrationNormal(dof_id_type node_id);
 
@@ -91,9 +98,67 @@ public:
   void setTangentialTolerance(Real tangential_tolerance);
   void setNormalSmoothingDistance(Real normal_smoothing_distance);
   void setNormalSmoothingMethod(std::string nsmString);
+
+  /**
+   * Keep the penetration info of the last search (pairings and distances) until a node on either
+   * surface has moved more than the given distance since that search. 0 (the default) searches
+   * every time.
+   */
+  void setSearchDisplacementTolerance(Real tolerance);
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
+  /**
+   * Number of searches done so far. Objects that cache data derived from the penetration info
+   * can compare it against the count their data was built for.
+   */
+  unsigned int searchCount() const { return _search_count; }
+
+  /**
+   * Data of a side on the master boundary that is shared by all slave nodes projecting onto it.
+   * The side element and its nodes only change with the mesh topology, the geometric data is
+   * recomputed when the nodes of the side have moved (e.g. on the displaced mesh).
+   */
+  struct MasterSide
+  {
+    unsigned int _side_num;
+    std::unique_ptr<Elem> _side;
+
+    /// Nodes of the side sorted by address
+    std::vector<const Node *> _sorted_nodes;
+
+    /// Node positions the geometric data below was computed for
+    std::vector<Point> _node_positions;
+
+    /// Reference coordinates of the centroid of the side
+    Point _centroid_ref;
+
+    /// Physical point and unit normal at the origin of the reference side
+    Point _origin;
+    RealVectorValue _normal;
+
+    Real _hmax;
+  };
+
+  /// Master boundary sides of each element that has sides on the master boundary
+  typedef std::map<dof_id_type, std::vector<MasterSide>> MasterSideMap;
+
 protected:
+  /// Rebuild the master side map if the mesh has changed since it was last built
+  void updateMasterSides();
+
+  /// Recompute the geometric data of the master sides whose nodes have moved
+  void updateMasterSideGeometry();
+
+  /// Recompute the geometric data of a master side if any of its nodes has moved
+  void updateMasterSideGeometry(MasterSide & master_side);
+
+  /// Has a node moved by more than the search displacement tolerance since the last search?
+  bool nodesMovedSinceLastSearch() const;
+
+  /// Store the positions of the nodes on both surfaces for nodesMovedSinceLastSearch()
+  void storeNodePositions();
+
+
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
   bool & _update_location;         // Update the penetration location for nodes found last time
@@ -103,6 +168,21 @@ protected:
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to
                                    // perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /// Sides on the master boundary, see MasterSide
+  MasterSideMap _master_sides;
+
+  /// Whether _master_sides has to be rebuilt before the next search
+  bool _master_sides_stale;
+
+  /// Number of searches done by detectPenetration()
+  unsigned int _search_count;
+
+  /// See setSearchDisplacementTolerance()
+  Real _search_displacement_tolerance;
+
+  /// Ids and positions of the slave and master nodes at the last search
+  std::vector<std::pair<dof_id_type, Point>> _searched_node_positions;
 };
 
 /**
@@ -18,6 +18,7 @@
 // MOOSE includes
 #include "MooseTypes.h"
 #include "PenetrationLocator.h"
+#include "NodeToElemMap.h"
 
 // Forward declarations
 class MooseVariable;
@@ -39,10 +40,8 @@ public:
                     std::vector<std::vector<FEBase *>> & fes,
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
-                    const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
-                    std::vector<dof_id_type> & elem_list,
-                    std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    const NodeToElemMap & node_to_elem_map,
+                    const PenetrationLocator::MasterSideMap & master_sides);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -77,13 +76,10 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const NodeToElemMap & _node_to_elem_map;
 
-  std::vector<dof_id_type> & _elem_list;
-  std::vector<unsigned short int> & _side_list;
-  std::vector<boundary_id_type> & _id_list;
-
-  unsigned int _n_elems;
+  /// Master boundary sides, their geometry is brought up to date before the search
+  const PenetrationLocator::MasterSideMap & _master_sides;
 
   THREAD_ID _tid;
 
@@ -123,9 +119,7 @@ protected:
                                           const std::vector<Node *> & edge_nodes);
   bool restrictPointToFace(Point & p, const Node *& closest_node, const Elem * side);
 
-  bool isFaceReasonableCandidate(const Elem * master_elem,
-                                 const Elem * side,
-                                 FEBase * fe,
+  bool isFaceReasonableCandidate(const PenetrationLocator::MasterSide & master_side,
                                  const Point * slave_point,
                                  const Real tangential_tolerance);
 
@@ -155,9 +149,11 @@ protected:
                          const Node * slave_node,
                          const Elem * elem,
                          const std::vector<const Node *> & nodes_that_must_be_on_side,
-                         const bool check_whether_reasonable = false);
+                         const bool check_whether_reasonable = false,
+                         const PenetrationInfo * previous_info = NULL);
 
-  void getSidesOnMasterBoundary(std::vector<unsigned int> & sides, const Elem * const elem);
+  /// Get the sides of elem on the master boundary, NULL if elem has none
+  const std::vector<PenetrationLocator::MasterSide> * getMasterSides(const Elem * elem);
 
   void computeSlip(FEBase & fe, PenetrationInfo & info);
 
@@ -100,6 +100,9 @@ public:
 
   virtual bool isEigenKernel() const { return _eigen_kernel; }
 
+  /// Returns true if the residual of this Kernel is saved into auxiliary variables
+  bool hasSaveIn() const { return _has_save_in; }
+
 protected:
   /// Reference to this kernel's SubProblem
   SubProblem & _subproblem;
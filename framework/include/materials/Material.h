@@ -37,6 +37,7 @@
 #include "OutputInterface.h"
 #include "RandomInterface.h"
 #include "MaterialProperty.h"
+#include "HashMap.h"
 
 // forward declarations
 class Material;
@@ -74,6 +75,8 @@ class Material : public MooseObject,
 public:
   Material(const InputParameters & parameters);
 
+  virtual ~Material();
+
   /**
    * Initialize stateful properties (if material has some)
    */
@@ -170,6 +173,24 @@ public:
    */
   bool isBoundaryMaterial() const { return _bnd; }
 
+  /**
+   * Clears the cached property values of a 'solution_independent' Material at the start of each
+   * time step
+   */
+  virtual void timestepSetup() override;
+
+  /**
+   * Clears the cached property values of a 'solution_independent' Material, they corresponded to
+   * the old mesh
+   */
+  virtual void meshChanged() override;
+
+  /**
+   * Delete the cached property values of a 'solution_independent' Material, called when the aux
+   * variables, postprocessors or controlled parameters it may depend on have changed
+   */
+  void clearCachedProperties();
+
 protected:
   /**
    * Users must override this method.
@@ -249,6 +270,11 @@ protected:
   /// that value around to all the qps.
   const bool _constant_on_elem;
 
+  /// False by default.  If true, MOOSE will only call computeQpProperties()
+  /// once per element (and side) per time step and reuse the stored values
+  /// during all subsequent residual and Jacobian evaluations.
+  const bool _solution_independent;
+
   enum QP_Data_Type
   {
     CURR,
@@ -273,6 +299,22 @@ private:
   bool _has_stateful_property;
 
   bool _overrides_init_stateful_props = true;
+
+  /**
+   * Copy the values of the supplied properties stored for the current element (and side) back
+   * into the MaterialData.
+   * @return false if nothing is stored for the current element yet
+   */
+  bool restoreCachedProperties();
+
+  /// Store the values of the supplied properties for the current element (and side)
+  void storeCachedProperties();
+
+  /// Stored property values of a 'solution_independent' Material, indexed by element and side
+  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> _cached_props;
+
+  /// The quadrature points the values in _cached_props were computed at
+  HashMap<const Elem *, HashMap<unsigned int, std::vector<Point>>> _cached_points;
 };
 
 template <typename T>
@@ -22,6 +22,7 @@
 // Forward declarations
 class Material;
 class MaterialData;
+class MooseMesh;
 class QpMap;
 
 // libMesh forward declarations
@@ -123,6 +124,19 @@ public:
                          const Elem & elem,
                          unsigned int side = 0);
 
+  /**
+   * Move the stateful properties of the elements that changed their owner in a repartitioning of
+   * a replicated mesh to the new owner. The properties of the elements that left this processor
+   * are released. Must be called on all processors.
+   *
+   * @param material_data MaterialData object used to allocate the received properties
+   * @param mesh The repartitioned mesh
+   * @param old_owners The processor ids of all elements (indexed by id) before the repartitioning
+   */
+  void redistributeStatefulProps(MaterialData & material_data,
+                                 MooseMesh & mesh,
+                                 const std::vector<processor_id_type> & old_owners);
+
   /**
    * Shift the material properties in time.
    *
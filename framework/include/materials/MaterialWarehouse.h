@@ -49,6 +49,12 @@ public:
   void sort(THREAD_ID tid = 0);
   ///@}
 
+  /**
+   * Delete the cached property values of all 'solution_independent' Block, Neighbor and Face
+   * material objects.
+   */
+  void clearCachedProperties(THREAD_ID tid = 0) const;
+
   /**
    * A special method unique to this class for adding Block, Neighbor, and Face material objects.
    */
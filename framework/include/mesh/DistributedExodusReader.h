@@ -0,0 +1,148 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DISTRIBUTEDEXODUSREADER_H
+#define DISTRIBUTEDEXODUSREADER_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/parallel_object.h"
+
+#include <string>
+#include <vector>
+
+// libMesh forward declarations
+namespace libMesh
+{
+class DistributedMesh;
+class MeshBase;
+class System;
+}
+
+/**
+ * Reads an Exodus file into a DistributedMesh without reading the whole file on any processor.
+ *
+ * Every processor reads a contiguous range of the elements (in file order) together with the
+ * nodes, side sets and node sets touching them, the elements neighboring the local ones are then
+ * gathered from the other processors the same way Nemesis_IO does it. The mesh is repartitioned
+ * afterwards by prepare_for_use(). The element and node ids are their positions in the file, so
+ * files whose node or element number maps are not the identity are rejected.
+ *
+ * The file stays open so that solution fields can be copied for a restart later. Each processor
+ * reads the values of a contiguous range of the nodes or elements, the values of the local nodes
+ * and elements of the (repartitioned) mesh are then requested from the processors that read them.
+ */
+class DistributedExodusReader : public libMesh::ParallelObject
+{
+public:
+  DistributedExodusReader(const std::string & file_name, const Parallel::Communicator & comm);
+  ~DistributedExodusReader();
+
+  /// Read the mesh, the elements end up on the processor that read them
+  void read(DistributedMesh & mesh);
+
+  /// Number of time steps in the file
+  int getNumTimeSteps() const;
+
+  /**
+   * Copy a nodal variable (first order Lagrange) into the solution of the system.
+   * @param system The system to copy into
+   * @param dest_name The variable of the system
+   * @param source_name The variable in the file
+   * @param timestep The time step in the file (one based)
+   */
+  void copyNodalSolution(System & system,
+                         const std::string & dest_name,
+                         const std::string & source_name,
+                         int timestep) const;
+
+  /// Copy an elemental variable (constant monomial) into the solution of the system
+  void copyElementalSolution(System & system,
+                             const std::string & dest_name,
+                             const std::string & source_name,
+                             int timestep) const;
+
+protected:
+  /// Element block metadata, read on every processor
+  struct Block
+  {
+    int _id;
+    std::string _type;
+    std::string _name;
+    int _num_elems;
+    int _num_nodes_per_elem;
+
+    /// Position of the first element of the block in the file (zero based)
+    dof_id_type _first_elem;
+  };
+
+  /// Read the sizes and the block metadata
+  void readHeader();
+
+  /// mooseError() if the node or element number map of the file is not the identity
+  void checkNumberMaps() const;
+
+  /// Read the names of the blocks or sets of the given type
+  std::vector<std::string> readNames(int type, int num) const;
+
+  /// Index into _blocks of the block containing the given element
+  std::size_t blockIndex(dof_id_type elem_index) const;
+
+  /// The contiguous range [begin, end) out of size entities read by this processor
+  std::pair<dof_id_type, dof_id_type> localRange(dof_id_type size) const;
+
+  /// The processor reading the given entity out of size entities
+  processor_id_type rangeOwner(dof_id_type index, dof_id_type size) const;
+
+  /**
+   * Send each processor its queries and call answer(pid, query, reply) for the queries received,
+   * the replies end up in the same order as the queries.
+   */
+  template <typename Query, typename Reply, typename Answer>
+  void exchange(const std::vector<std::vector<Query>> & queries,
+                std::vector<std::vector<Reply>> & replies,
+                Answer answer) const;
+
+  /// Index of a variable in the file, one based
+  int variableIndex(int type, const std::string & name) const;
+
+  /// Read the values of a variable for the range of nodes or elements read by this processor
+  void readRangeValues(int type, int var_index, int timestep, std::vector<Real> & values) const;
+
+  /// Copy the values of the given (local) entities, sorted by id, into the solution
+  void copySolution(System & system,
+                    const std::vector<std::pair<dof_id_type, dof_id_type>> & id_to_dof,
+                    int type,
+                    int var_index,
+                    int timestep,
+                    dof_id_type size) const;
+
+  /// mooseError() if err is negative
+  void check(int err, const std::string & what) const;
+
+  const std::string _file_name;
+
+  /// The Exodus file id
+  int _exoid;
+
+  int _num_dim;
+  int _num_nodes;
+  int _num_elems;
+  int _num_node_sets;
+  int _num_side_sets;
+
+  std::vector<Block> _blocks;
+};
+
+#endif // DISTRIBUTEDEXODUSREADER_H
@@ -16,6 +16,7 @@
 #define FILEMESH_H
 
 #include "MooseMesh.h"
+#include "DistributedExodusReader.h"
 
 // forward declaration
 class FileMesh;
@@ -36,6 +37,10 @@ public:
 
   void read(const std::string & file_name);
   virtual ExodusII_IO * exReader() const override { return _exreader.get(); }
+  virtual DistributedExodusReader * distributedExReader() const override
+  {
+    return _distributed_reader.get();
+  }
 
   // Get/Set Filename (for meshes read from a file)
   void setFileName(const std::string & file_name) { _file_name = file_name; }
@@ -46,6 +51,8 @@ protected:
   std::string _file_name;
   /// Auxiliary object for restart
   std::unique_ptr<ExodusII_IO> _exreader;
+  /// Reader of an Exodus file read in parallel, also used for restart
+  std::unique_ptr<DistributedExodusReader> _distributed_reader;
 };
 
 #endif // FILEMESH_H
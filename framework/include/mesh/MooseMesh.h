@@ -18,20 +18,24 @@
 #include "MooseObject.h"
 #include "BndNode.h"
 #include "BndElement.h"
+#include "NodeToElemMap.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
 
 #include <memory> //std::unique_ptr
+#include <deque>
 
 // libMesh
 #include "libmesh/mesh.h"
 #include "libmesh/elem_range.h"
 #include "libmesh/node_range.h"
 #include "libmesh/mesh_tools.h"
+#include "libmesh/threads.h"
 
 // forward declaration
 class MooseMesh;
 class Assembly;
+class DistributedExodusReader;
 
 // libMesh forward declarations
 namespace libMesh
@@ -146,7 +150,8 @@ public:
    * Calls BoundaryInfo::build_node_list()/build_side_list() and *makes separate copies* of
    * Nodes/Elems in those lists.
    *
-   * Allocates memory which is cleaned up in the freeBndNodes()/freeBndElems() functions.
+   * The BndNode/BndElement objects are stored contiguously, the memory is released in the
+   * freeBndNodes()/freeBndElems() functions.
    */
   void buildNodeList();
   void buildBndElemList();
@@ -155,7 +160,7 @@ public:
    * If not already created, creates a map from every node to all
    * elements to which they are connected.
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToElemMap();
+  const NodeToElemMap & nodeToElemMap();
 
   /**
    * If not already created, creates a map from every node to all
@@ -164,7 +169,7 @@ public:
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToActiveSemilocalElemMap();
+  const NodeToElemMap & nodeToActiveSemilocalElemMap();
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -472,6 +477,11 @@ public:
    */
   virtual ExodusII_IO * exReader() const;
 
+  /**
+   * The reader of a mesh read in parallel (see FileMesh "distributed_read"), NULL otherwise.
+   */
+  virtual DistributedExodusReader * distributedExReader() const { return nullptr; }
+
   /**
    * Calls print_info() on the underlying Mesh.
    */
@@ -811,6 +821,24 @@ public:
   bool isCustomPartitionerRequested() const;
   void setIsCustomPartitionerRequested(bool cpr);
 
+  ///@{
+  /**
+   * Measured per element cost (e.g. assembly time) used as partition weights. The residual and
+   * Jacobian loops only measure the costs once enableElementCosts() was called. The costs are
+   * reset every time the mesh changes. Only the entries of local elements are filled in.
+   */
+  void enableElementCosts() { _element_costs_enabled = true; }
+  bool elementCostsEnabled() const { return _element_costs_enabled; }
+  void addElementCost(const Elem * elem, Real cost)
+  {
+    // The costs are sized on mesh updates, an element without an entry is not measured until the
+    // next update
+    if (elem->id() < _element_costs.size())
+      _element_costs[elem->id()] += cost;
+  }
+  const std::vector<Real> & elementCosts() const { return _element_costs; }
+  ///@}
+
   /// Getter to query if the mesh was detected to be regular and orthogonal
   bool isRegularOrthogonal() { return _regular_orthogonal_mesh; }
 
@@ -853,6 +881,10 @@ protected:
   std::unique_ptr<Partitioner> _custom_partitioner;
   bool _custom_partitioner_requested;
 
+  /// Measured element costs indexed by element id
+  std::vector<Real> _element_costs;
+  bool _element_costs_enabled;
+
   /// Convenience enums
   enum
   {
@@ -907,13 +939,16 @@ protected:
       _bnd_elem_range;
 
   /// A map of all of the current nodes to the elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_elem_map;
+  NodeToElemMap _node_to_elem_map;
   bool _node_to_elem_map_built;
 
   /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_active_semilocal_elem_map;
+  NodeToElemMap _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
+  /// Guards the lazy construction of the node to elem maps
+  Threads::spin_mutex _node_to_elem_map_mutex;
+
   /**
    * A set of subdomain IDs currently present in the mesh.
    * For parallel meshes, includes subdomains defined on other
@@ -936,24 +971,33 @@ protected:
   /// The boundary to normal map - valid only when AddAllSideSetsByNormals is active
   std::unique_ptr<std::map<BoundaryID, RealVectorValue>> _boundary_to_normal_map;
 
-  /// array of boundary nodes
+  /// storage of the boundary nodes built from the mesh
+  std::vector<BndNode> _bnd_node_storage;
+  /// array of boundary nodes, points into _bnd_node_storage and _extra_bnd_nodes
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_node_ids;
+  /**
+   * Sorted node IDs in each boundary. Quadrature nodes are appended unsorted, the lists are
+   * sorted again on the next lookup (see sortBoundaryNodeIDs())
+   */
+  mutable std::map<boundary_id_type, std::vector<dof_id_type>> _bnd_node_ids;
+  mutable bool _bnd_node_ids_sorted;
 
-  /// array of boundary elems
+  /// storage of the boundary elems
+  std::vector<BndElement> _bnd_elem_storage;
+  /// array of boundary elems, points into _bnd_elem_storage
   std::vector<BndElement *> _bnd_elems;
   typedef std::vector<BndElement *>::iterator bnd_elem_iterator_imp;
   typedef std::vector<BndElement *>::const_iterator const_bnd_elem_iterator_imp;
-  /// Map of set of elem IDs connected to each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_elem_ids;
+  /// Sorted elem IDs connected to each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type>> _bnd_elem_ids;
 
   std::map<dof_id_type, Node *> _quadrature_nodes;
   std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *>>>
       _elem_to_side_to_qp_to_quadrature_nodes;
-  std::vector<BndNode> _extra_bnd_nodes;
+  /// boundary nodes of the quadrature nodes, a deque so that _bnd_nodes can point into it
+  std::deque<BndNode> _extra_bnd_nodes;
 
   /// list of nodes that belongs to a specified block (domain)
   std::map<dof_id_type, std::set<SubdomainID>> _block_node_list;
@@ -995,6 +1039,9 @@ protected:
   void freeBndNodes();
   void freeBndElems();
 
+  /// Sort the node ID lists of the boundaries quadrature nodes were added to
+  void sortBoundaryNodeIDs() const;
+
 private:
   /**
    * A map of vectors indicating which dimensions are periodic in a regular orthogonal mesh for
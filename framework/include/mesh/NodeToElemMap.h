@@ -0,0 +1,131 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NODETOELEMMAP_H
+#define NODETOELEMMAP_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/elem_range.h"
+
+#include <map>
+#include <vector>
+
+/**
+ * Node to element adjacency stored in compressed sparse row format: the ids of the elements
+ * connected to node i are _elems[_offsets[i]] ... _elems[_offsets[i + 1] - 1], sorted by element
+ * id. Nodes added after the build (e.g. quadrature nodes, whose ids are far beyond the mesh node
+ * ids) are kept in a separate map.
+ *
+ * When the elements only touch a small part of the node ids (e.g. the semilocal elements of a
+ * DistributedMesh), i is the position of the node id in a sorted list of the connected node ids
+ * instead of the node id itself, so that the storage does not scale with the global mesh.
+ *
+ * The lookup interface mimics a const std::map<dof_id_type, std::vector<dof_id_type>>: find()
+ * returns an iterator whose ->second is the list of connected elements, or end() if the node is
+ * not connected to any element.
+ */
+class NodeToElemMap
+{
+public:
+  /// The elements connected to a single node
+  class ElemList
+  {
+  public:
+    ElemList(const dof_id_type * begin = nullptr, const dof_id_type * end = nullptr)
+      : _begin(begin), _end(end)
+    {
+    }
+
+    const dof_id_type * begin() const { return _begin; }
+    const dof_id_type * end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    const dof_id_type & operator[](std::size_t i) const { return _begin[i]; }
+
+  private:
+    const dof_id_type * _begin;
+    const dof_id_type * _end;
+  };
+
+  typedef std::pair<dof_id_type, ElemList> value_type;
+
+  /// Iterator to a single entry, only supports dereferencing and comparison
+  class const_iterator
+  {
+  public:
+    const_iterator() : _valid(false) {}
+    const_iterator(dof_id_type node_id, const ElemList & elems)
+      : _value(node_id, elems), _valid(true)
+    {
+    }
+
+    const value_type & operator*() const { return _value; }
+    const value_type * operator->() const { return &_value; }
+
+    bool operator==(const const_iterator & other) const
+    {
+      return _valid == other._valid && (!_valid || _value.first == other._value.first);
+    }
+    bool operator!=(const const_iterator & other) const { return !(*this == other); }
+
+  private:
+    value_type _value;
+    bool _valid;
+  };
+
+  NodeToElemMap();
+
+  /**
+   * Build the adjacency of the given elements. The elements are counted and inserted in parallel
+   * with threads.
+   * @param elems The elements to include
+   * @param max_node_id One past the largest node id of the elements
+   * @param active_only Skip inactive elements in the range
+   */
+  void build(const ConstElemRange & elems, dof_id_type max_node_id, bool active_only);
+
+  /// Connect an element to a node that was not part of the build
+  void addNode(dof_id_type node_id, dof_id_type elem_id);
+
+  /// Remove the nodes added with addNode()
+  void clearExtraNodes() { _extra_nodes.clear(); }
+
+  /// Remove everything
+  void clear();
+
+  const_iterator find(dof_id_type node_id) const;
+  const_iterator end() const { return const_iterator(); }
+
+protected:
+  /// The position of a node in _offsets, or _offsets.size() if the node is not part of the build
+  std::size_t index(dof_id_type node_id) const;
+
+  /// Sorted ids of the connected nodes when the ids are compacted, empty otherwise
+  std::vector<dof_id_type> _node_ids;
+
+  /// Whether _offsets is indexed by the position in _node_ids rather than the node id
+  bool _compact;
+
+  /// Offsets of each node into _elems, one past the number of nodes in size
+  std::vector<dof_id_type> _offsets;
+
+  /// The ids of the connected elements of all nodes
+  std::vector<dof_id_type> _elems;
+
+  /// Connectivity of nodes added after the build
+  std::map<dof_id_type, std::vector<dof_id_type>> _extra_nodes;
+};
+
+#endif // NODETOELEMMAP_H
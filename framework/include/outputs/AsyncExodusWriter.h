@@ -0,0 +1,118 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ASYNCEXODUSWRITER_H
+#define ASYNCEXODUSWRITER_H
+
+#include "Moose.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Writes time steps into an existing Exodus file on a background thread.
+ *
+ * The file (mesh, variable names and blocks) must have been created by libMesh::ExodusII_IO and
+ * closed again. Each Snapshot holds all values of one time step, already in the order of the file,
+ * so the writer does not touch the mesh or the solution. At most one snapshot is written at a
+ * time, write() waits for the previous one to finish.
+ *
+ * NetCDF is not thread safe: the writers hold netcdfMutex() while writing, and every other
+ * Exodus and Nemesis read or write in the framework takes the same lock.
+ */
+class AsyncExodusWriter
+{
+public:
+  /// The values of a single time step
+  struct Snapshot
+  {
+    std::string _file_name;
+
+    /// The Exodus time step (one based)
+    int _timestep;
+
+    Real _time;
+
+    /// The nodal values of each variable, in the order of the variables in the file
+    std::vector<std::vector<Real>> _nodal_values;
+
+    /// The block ids, in the order of the blocks in the file
+    std::vector<int> _block_ids;
+
+    /// The elemental values of each variable (outer) and block (inner)
+    std::vector<std::vector<std::vector<Real>>> _elemental_values;
+
+    std::vector<Real> _global_values;
+  };
+
+  AsyncExodusWriter();
+
+  /// Finishes the pending writes
+  ~AsyncExodusWriter();
+
+  /// Queue a time step for writing, waits until the previous one is written
+  void write(std::unique_ptr<Snapshot> snapshot);
+
+  /// Wait until all queued time steps are written
+  void flush();
+
+  /// Number of time steps written
+  unsigned int numWrites() const { return _num_writes; }
+
+  /// Total time spent writing on the background thread
+  Real writeTime() const { return _write_time; }
+
+  /// Total time the caller spent waiting for the background thread
+  Real waitTime() const { return _wait_time; }
+
+  /// The lock serializing all NetCDF calls of the framework
+  static std::mutex & netcdfMutex();
+
+private:
+  /// The loop of the background thread
+  void run();
+
+  /// Write a time step into its file
+  void writeSnapshot(const Snapshot & snapshot);
+
+  /// Wait (with _mutex held) until nothing is queued or written, raises errors of the thread
+  void waitIdle(std::unique_lock<std::mutex> & lock);
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+
+  /// The time step waiting to be written
+  std::unique_ptr<Snapshot> _pending;
+
+  /// Is the thread writing a time step?
+  bool _busy;
+
+  /// Tells the thread to finish
+  bool _stop;
+
+  /// The error of the last failed write, reported on the calling thread
+  std::string _error;
+
+  unsigned int _num_writes;
+  Real _write_time;
+  Real _wait_time;
+
+  std::thread _thread;
+};
+
+#endif // ASYNCEXODUSWRITER_H
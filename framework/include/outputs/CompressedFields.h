@@ -0,0 +1,98 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDFIELDS_H
+#define COMPRESSEDFIELDS_H
+
+// MOOSE includes
+#include "OversampleOutput.h"
+#include "CompressedFieldWriter.h"
+
+// Forward declarations
+class CompressedFields;
+
+template <>
+InputParameters validParams<CompressedFields>();
+
+/**
+ * Class for output of the nodal and elemental variables to a compressed field file (*.mcf), which
+ * stores each output step as the difference to the previous one.
+ *
+ * The mesh is written to an ExodusII file (*_mesh.e) next to it. SolutionUserObject and
+ * ExodusTimeSequenceStepper read the *.mcf file in place of an ExodusII file. A new pair of files
+ * is started when the mesh changes.
+ */
+class CompressedFields : public OversampleOutput
+{
+public:
+  /**
+   * Class constructor
+   */
+  CompressedFields(const InputParameters & parameters);
+
+  /**
+   * Reports the compression ratio and write bandwidth after the final output
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
+  /**
+   * Starts a new file for the changed mesh
+   */
+  virtual void meshChanged() override;
+
+protected:
+  /**
+   * Collects the variables on the first processor and writes them
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Returns the name of the field file, with the -s00x suffix after a mesh change
+   */
+  virtual std::string filename() override;
+
+private:
+  /// Read the ids of the nodes and elements in the order of the written mesh file
+  void readNumberMaps(const std::string & mesh_name);
+
+  /// The nodal values of each nodal output variable in mesh file order (first processor only)
+  void collectNodalVariables(std::vector<std::vector<Real>> & values);
+
+  /// The values of each elemental output variable in mesh file order (first processor only)
+  void collectElementalVariables(std::vector<std::vector<Real>> & values);
+
+  /// The absolute error bound, zero for lossless compression
+  const Real _error_bound;
+
+  /// The number of output steps between keyframes
+  const unsigned int _keyframe_interval;
+
+  /// The ids of the nodes and elements in the order of the mesh file (only on the first processor)
+  std::vector<dof_id_type> _node_ids;
+  std::vector<dof_id_type> _elem_ids;
+
+  /// The writer of the current file (only on the first processor)
+  std::unique_ptr<CompressedFieldWriter> _writer;
+
+  /// True when the next output starts a new file
+  bool _new_file;
+
+  /// The totals of the files finished before the current one
+  unsigned int _num_steps;
+  std::size_t _raw_bytes;
+  std::size_t _written_bytes;
+  Real _write_time;
+};
+
+#endif // COMPRESSEDFIELDS_H
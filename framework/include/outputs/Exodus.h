@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "OversampleOutput.h"
+#include "AsyncExodusWriter.h"
 
 // Forward declarations
 class Exodus;
@@ -41,12 +42,22 @@ public:
    */
   Exodus(const InputParameters & parameters);
 
+  /**
+   * Class destructor, finishes the background writes
+   */
+  virtual ~Exodus();
+
   /**
    * Overload the OutputBase::output method, this is required for ExodusII
    * output due to the method utilized for outputing single/global parameters
    */
   virtual void output(const ExecFlagType & type) override;
 
+  /**
+   * Finishes the background writes and reports their timing after the final output
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
   /**
    * Performs basic error checking and initial setup of ExodusII_IO output object
    */
@@ -119,6 +130,18 @@ protected:
   /// Storage for names of the above scalar values
   std::vector<std::string> _global_names;
 
+  /// The background writer (only on the processor writing the file when 'asynchronous = true')
+  std::unique_ptr<AsyncExodusWriter> _async_writer;
+
+  /// The time step being collected for the background writer (only on the writing processor)
+  std::unique_ptr<AsyncExodusWriter::Snapshot> _snapshot;
+
+  /// The file continued by the background writer, empty if the file is written by _exodus_io_ptr
+  std::string _async_file;
+
+  /// True while the current time step is collected for the background writer
+  bool _async_step;
+
   /**
    * Flag for indicating the status of the ExodusII file that is being written. The ExodusII_IO
    * interface requires that the file be 'initialized' prior to writing any type of data. This
@@ -142,6 +165,12 @@ private:
    */
   void outputEmptyTimestep();
 
+  /// Collect the nodal variables of the current time step for the background writer
+  void snapshotNodalVariables();
+
+  /// Collect the elemental variables of the current time step for the background writer
+  void snapshotElementalVariables();
+
   /// Count of outputs per exodus file
   unsigned int & _exodus_num;
 
@@ -159,6 +188,9 @@ private:
 
   /// Flag for overwriting timesteps
   bool _overwrite;
+
+  /// Write all but the first time step of each file on a background thread
+  const bool _asynchronous;
 };
 
 #endif /* EXODUS_H */
@@ -0,0 +1,61 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+#ifndef COSTWEIGHTEDPARTITIONER_H
+#define COSTWEIGHTEDPARTITIONER_H
+
+// MOOSE includes
+#include "MoosePartitioner.h"
+
+class CostWeightedPartitioner;
+class MooseMesh;
+
+template <>
+InputParameters validParams<CostWeightedPartitioner>();
+
+/**
+ * Metis partitioner that weights the elements with their measured assembly cost (the time the
+ * residual and Jacobian loops spent on them since the last mesh change). Before any cost was
+ * measured the elements are weighted equally.
+ *
+ * Transient executioners ask FEProblemBase::rebalanceMesh() to repartition with this partitioner
+ * after every time step in which the measured cost of the processors was out of balance.
+ */
+class CostWeightedPartitioner : public MoosePartitioner
+{
+public:
+  CostWeightedPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  /**
+   * Ratio of the largest measured cost of a processor to the average cost of all processors, or
+   * zero if no cost was measured yet. Must be called on all processors.
+   */
+  Real imbalance() const;
+
+  /// Imbalance above which the mesh is repartitioned
+  Real imbalanceTolerance() const { return _imbalance_tolerance; }
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  MooseMesh & _mesh;
+
+  const Real _imbalance_tolerance;
+
+  /// Partition weight of an element with the average cost
+  const Real _weight_resolution;
+};
+
+#endif /* COSTWEIGHTEDPARTITIONER_H */
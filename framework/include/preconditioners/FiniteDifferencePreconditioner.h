@@ -29,6 +29,10 @@ class FiniteDifferencePreconditioner : public MoosePreconditioner
 {
 public:
   FiniteDifferencePreconditioner(const InputParameters & params);
+
+protected:
+  /// How the finite differenced Jacobian is computed
+  const MooseEnum _finite_difference_type;
 };
 
 #endif /* FINITEDIFFERENCEPRECONDITIONER_H */
@@ -43,6 +43,12 @@ InputParameters validParams<Sampler>();
  * Samplers support the use of "execute_on", which when called results in new set of random numbers,
  * thus after execute() runs the getSamples() method will now produces a new set of random numbers
  * from calls prior to the execute() call.
+ *
+ * The samples may also be accessed by rows, numbered consecutively through all of the matrices
+ * returned by getSamples(). With generator = counter each number is computed from the seed and its
+ * row and column alone (see counterRand()), so every processor generates only the rows it needs
+ * (getLocalSamples(), getSampleRow()) and the samples do not depend on the number of processors.
+ * Samplers support this by overriding sampleMatrixRows() and computeSampleRow().
  */
 class Sampler : public MooseObject, public SetupInterface, public DistributionInterface
 {
@@ -73,6 +79,41 @@ public:
    */
   void execute();
 
+  /**
+   * Whether the samples are computed from the row and column counters (generator = counter)
+   */
+  bool hasCounterGenerator() const { return _counter_generator; }
+
+  /**
+   * Return the number of rows of each sample matrix.
+   */
+  std::vector<std::size_t> getMatrixRowCounts();
+
+  /**
+   * Return the total number of rows of all sample matrices.
+   */
+  std::size_t getNumberOfRows();
+
+  ///@{
+  /**
+   * The range of rows assigned to this processor, the rows are split evenly among the processors.
+   */
+  std::size_t getLocalRowBegin();
+  std::size_t getLocalRowEnd();
+  ///@}
+
+  /**
+   * Return the rows assigned to this processor. With the counter generator only these rows are
+   * computed.
+   */
+  DenseMatrix<Real> getLocalSamples();
+
+  /**
+   * Return a single row. With the counter generator only this row is computed.
+   * @param global_row The row number counted through all sample matrices
+   */
+  std::vector<Real> getSampleRow(std::size_t global_row);
+
 protected:
   /**
    * Get the next random number from the generator.
@@ -88,6 +129,27 @@ protected:
    */
   virtual std::vector<DenseMatrix<Real>> sample() = 0;
 
+  /**
+   * Return the number of rows of each matrix returned by sample(). The default implementation
+   * generates all of the samples, samplers should override it.
+   */
+  virtual std::vector<std::size_t> sampleMatrixRows();
+
+  /**
+   * Compute a single row of a sample matrix, required for the counter generator. The numbers
+   * must come from counterRand().
+   * @param matrix The index of the sample matrix
+   * @param row The row within the matrix
+   * @param data The row, to be sized to the number of columns
+   */
+  virtual void computeSampleRow(unsigned int matrix, std::size_t row, std::vector<Real> & data);
+
+  /**
+   * Counter based random number in [0, 1): a hash of the seed, the number of executions, the
+   * stream and the row and column of the sample.
+   */
+  double counterRand(std::size_t row, unsigned int col, unsigned int stream = 0) const;
+
   /**
    * Set the number of seeds required by the sampler. The Sampler will generate
    * additional seeds as needed. This function should be called in the constructor
@@ -111,6 +173,12 @@ private:
 
   /// Initial random number seed
   const unsigned int & _seed;
+
+  /// Compute the samples from the row and column counters
+  const bool _counter_generator;
+
+  /// Number of calls to execute(), selects a new set of counter based samples
+  unsigned int _execute_count;
 };
 
 #endif /* SAMPLER_H */
@@ -0,0 +1,108 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EXPLICITSSPRUNGEKUTTA_H
+#define EXPLICITSSPRUNGEKUTTA_H
+
+#include "TimeIntegrator.h"
+
+class ExplicitSSPRungeKutta;
+
+template <>
+InputParameters validParams<ExplicitSSPRungeKutta>();
+
+/**
+ * Matrix free explicit strong stability preserving (SSP) Runge-Kutta methods of order 1 to 3
+ * with a lumped mass matrix, written in the Shu-Osher form
+ *
+ *   U^{(0)} = U^n
+ *   U^{(s)} = a_s U^n + (1 - a_s) (U^{(s-1)} + dt M_L^{-1} F(t^n + c_s dt, U^{(s-1)}))
+ *   U^{n+1} = U^{(S)}
+ *
+ * with (a_s; c_s) = (0; 0) for order 1 (forward Euler), (0, 1/2; 0, 1) for order 2 and
+ * (0, 3/4, 1/3; 0, 1, 1/2) for order 3.
+ *
+ *   Reference:
+ *   Gottlieb, S., Shu, C. W., & Tadmor, E. (2001).
+ *   Strong stability-preserving high-order time discretization methods.
+ *   SIAM review, 43(1), 89-112.
+ *
+ * The lumped mass M_L is the time residual computed with u_dot = 1, i.e. the row sums of the mass
+ * matrix. It is assembled once and reassembled only when the mesh changes, so the time kernels
+ * must be linear in u_dot with coefficients that do not change in time. Every stage costs one
+ * evaluation of the non-time residual and a few vector operations; neither the nonlinear solver
+ * nor the Jacobian is used. Nodal BCs are imposed after every stage by setting the solution to the
+ * value that zeroes their residual.
+ *
+ * Unlike the ExplicitEuler family, the non-time Kernels are evaluated at the stage solution, so
+ * they must NOT be marked "implicit=false" for orders 2 and 3, which is an error.
+ */
+class ExplicitSSPRungeKutta : public TimeIntegrator
+{
+public:
+  ExplicitSSPRungeKutta(const InputParameters & parameters);
+
+  virtual int order() override { return _order; }
+  virtual void computeTimeDerivatives() override;
+  virtual void solve() override;
+  virtual void postStep(NumericVector<Number> & residual) override;
+  virtual void meshChanged() override { _lumped_mass_valid = false; }
+  virtual bool usesNonlinearSolver() const override { return false; }
+
+  /**
+   * Estimate the spectral radius of the linearized explicit operator M_L^{-1} dF/du at the
+   * current solution with a few power iterations. Each iteration costs one residual evaluation;
+   * the Jacobian vector products are approximated by finite differences. Used by CFLDT.
+   */
+  Real spectralRadius(unsigned int iterations);
+
+protected:
+  /// Error if a non-time kernel is evaluated at the old solution while the order is above one
+  void checkKernels();
+
+  /// Assemble the lumped mass and the mask of the dofs constrained by nodal BCs
+  void computeLumpedMass();
+
+  /// Compute the non-time residual at the current solution
+  void computeStageResidual(NumericVector<Number> & residual);
+
+  /// Compute the residual of the nodal BCs alone at the current solution, zero on all other dofs
+  void computeNodalBCResidual(NumericVector<Number> & residual);
+
+  const unsigned int _order;
+
+  /// Weight of U^n in each stage
+  std::vector<Real> _old_weight;
+
+  /// Stage times as fractions of dt
+  std::vector<Real> _stage_time;
+
+  /// Inverse of the lumped mass, zero on the dofs constrained by nodal BCs
+  NumericVector<Number> & _inverse_mass;
+
+  /// One on the unconstrained dofs, zero on the dofs constrained by nodal BCs
+  NumericVector<Number> & _interior_mask;
+
+  /// Scratch vectors
+  NumericVector<Number> & _increment;
+  NumericVector<Number> & _work;
+  NumericVector<Number> & _direction;
+
+  bool _lumped_mass_valid;
+
+  /// True while the lumped mass is assembled, computeTimeDerivatives() then sets u_dot = 1
+  bool _computing_mass;
+};
+
+#endif /* EXPLICITSSPRUNGEKUTTA_H */
@@ -74,6 +74,19 @@ public:
    */
   virtual void postSolve() {}
 
+  /**
+   * Called after the mesh changed (adaptivity, repartitioning), before the next solve. Integrators
+   * that cache data depending on the mesh or the dof numbering invalidate it here.
+   */
+  virtual void meshChanged() {}
+
+  /**
+   * Whether solve() uses the nonlinear solver. Integrators that update the solution directly
+   * return false, which skips the initial residual evaluation done for the nonlinear convergence
+   * check.
+   */
+  virtual bool usesNonlinearSolver() const { return true; }
+
   virtual int order() = 0;
   virtual void computeTimeDerivatives() = 0;
 
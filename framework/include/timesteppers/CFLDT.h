@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef CFLDT_H
+#define CFLDT_H
+
+#include "TimeStepper.h"
+
+class CFLDT;
+class ExplicitSSPRungeKutta;
+
+template <>
+InputParameters validParams<CFLDT>();
+
+/**
+ * Computes dt from the stability limit of the explicit ExplicitSSPRungeKutta integrator:
+ * dt = courant_number / rho, where rho is the spectral radius of the linearized explicit operator
+ * estimated with a few matrix free power iterations.
+ */
+class CFLDT : public TimeStepper
+{
+public:
+  CFLDT(const InputParameters & parameters);
+
+  virtual void init() override;
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  /// Re-estimate the spectral radius if it is due and return the stable dt
+  Real stableDT();
+
+  const Real _courant_number;
+  const unsigned int _power_iterations;
+  const unsigned int _interval;
+
+  ExplicitSSPRungeKutta * _integrator;
+
+  /// The last estimate of the spectral radius
+  Real _spectral_radius;
+
+  /// Number of steps since the last estimate
+  unsigned int _steps_since_estimate;
+};
+
+#endif /* CFLDT_H */
@@ -32,13 +32,11 @@ class LayeredAverage : public LayeredIntegral
 public:
   LayeredAverage(const InputParameters & parameters);
 
-  virtual void initialize() override;
   virtual void execute() override;
-  virtual void finalize() override;
-  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalizeLayers() override;
 
 protected:
-  /// Value of the volume for each layer
+  /// Value of the volume for each layer, summed along with the layer values by LayeredBase
   std::vector<Real> _layer_volumes;
 };
 
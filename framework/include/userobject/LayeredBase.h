@@ -28,6 +28,10 @@ class UserObject;
 namespace libMesh
 {
 class Point;
+namespace Parallel
+{
+class Communicator;
+}
 }
 
 template <typename T>
@@ -53,6 +57,14 @@ public:
    */
   virtual Real integralValue(Point p) const;
 
+  /**
+   * Return the integral values associated with the layers a batch of points falls in.
+   *
+   * @param points The points to look for in the layers.
+   * @param values The value at each point (output).
+   */
+  void integralValues(const std::vector<Point> & points, std::vector<Real> & values) const;
+
   /**
    * Get the value for a given layer
    * @param layer The layer index
@@ -67,10 +79,36 @@ public:
    */
   virtual unsigned int getLayer(Point p) const;
 
+  /**
+   * Find the layers for a batch of points.
+   * @param points The points.
+   * @param layers The layer each point is found in (output).
+   */
+  void getLayers(const std::vector<Point> & points, std::vector<unsigned int> & layers) const;
+
   virtual void initialize();
   virtual void finalize();
   virtual void threadJoin(const UserObject & y);
 
+  /**
+   * Post-process the layer values once they have been summed across processors.
+   * Called from finalize() or, for a batch of objects, after sumLayers().  The
+   * problem sums the layers of all of its layered UserObjects before finalizing
+   * them, in which case finalize() does not reduce again.
+   */
+  virtual void finalizeLayers();
+
+  /**
+   * Sum the layer values (and additional layer data) of several objects across processors
+   * using a single reduction.  If few layers have been touched only the touched layers are
+   * communicated, otherwise all layers are summed.
+   *
+   * @param objects The objects to reduce, the same objects in the same order on every processor.
+   * @param comm The communicator to reduce over.
+   */
+  static void sumLayers(const std::vector<LayeredBase *> & objects,
+                        const Parallel::Communicator & comm);
+
 protected:
   /**
    * Set the value for a particular layer
@@ -84,6 +122,14 @@ protected:
    */
   bool layerHasValue(unsigned int layer) const { return _layer_has_value[layer]; }
 
+  /**
+   * Register an additional per-layer vector that is zeroed in initialize() and summed
+   * together with the layer values in threadJoin() and finalize().  Entries may only be
+   * modified for layers that have a value set through setLayerValue().
+   * @param data The data, resized to the number of layers
+   */
+  void addLayerData(std::vector<Real> & data);
+
   /// Name of this object
   std::string _layered_base_name;
 
@@ -115,12 +161,26 @@ protected:
   Real _direction_max;
 
 private:
+  /**
+   * Sample the layer values at a point in the given layer according to the sample type.
+   */
+  Real sampleLayers(const Point & p, unsigned int layer) const;
+
   /// Value of the integral for each layer
   std::vector<Real> _layer_values;
 
   /// Whether or not each layer has had any value summed into it
   std::vector<bool> _layer_has_value;
 
+  /// The layers that have had a value set since initialize()
+  std::vector<unsigned int> _touched_layers;
+
+  /// Additional per-layer data summed together with the layer values
+  std::vector<std::vector<Real> *> _layer_data;
+
+  /// Whether the layers have been summed across processors since initialize()
+  bool _layers_summed;
+
   /// Subproblem for the child object
   SubProblem & _layered_base_subproblem;
 
@@ -41,6 +41,12 @@ public:
    */
   virtual Real spatialValue(const Point & p) const override { return integralValue(p); }
 
+  virtual void spatialValues(const std::vector<Point> & points,
+                             std::vector<Real> & values) const override
+  {
+    integralValues(points, values);
+  }
+
   virtual void initialize() override;
   virtual void execute() override;
   virtual void finalize() override;
@@ -73,7 +73,25 @@ public:
    */
   virtual Real spatialValue(const Point & p) const override;
 
+  /**
+   * Evaluate a batch of points, handing each of the nearest UserObjects
+   * all of the points closest to it at once.
+   *
+   * @param points The points to look for in the layers.
+   * @param values The value at each point (output).
+   */
+  virtual void spatialValues(const std::vector<Point> & points,
+                             std::vector<Real> & values) const override;
+
 protected:
+  /**
+   * Get the index of the UserObject that is closest to the point.
+   *
+   * @param p The point.
+   * @return The index of the UserObject closest to p.
+   */
+  unsigned int nearestUserObjectIndex(const Point & p) const;
+
   /**
    * Get the UserObject that is closest to the point.
    *
@@ -142,9 +160,44 @@ NearestPointBase<UserObjectType>::spatialValue(const Point & p) const
   return nearestUserObject(p)->spatialValue(p);
 }
 
+template <typename UserObjectType>
+void
+NearestPointBase<UserObjectType>::spatialValues(const std::vector<Point> & points,
+                                                std::vector<Real> & values) const
+{
+  // Group the points by the UserObject closest to them
+  std::vector<std::vector<Point>> grouped_points(_user_objects.size());
+  std::vector<std::vector<std::size_t>> grouped_indices(_user_objects.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    const unsigned int closest = nearestUserObjectIndex(points[i]);
+    grouped_points[closest].push_back(points[i]);
+    grouped_indices[closest].push_back(i);
+  }
+
+  values.resize(points.size());
+  std::vector<Real> grouped_values;
+  for (unsigned int j = 0; j < _user_objects.size(); ++j)
+  {
+    if (grouped_points[j].empty())
+      continue;
+
+    _user_objects[j]->spatialValues(grouped_points[j], grouped_values);
+    for (std::size_t k = 0; k < grouped_indices[j].size(); ++k)
+      values[grouped_indices[j][k]] = grouped_values[k];
+  }
+}
+
 template <typename UserObjectType>
 std::shared_ptr<UserObjectType>
 NearestPointBase<UserObjectType>::nearestUserObject(const Point & p) const
+{
+  return _user_objects[nearestUserObjectIndex(p)];
+}
+
+template <typename UserObjectType>
+unsigned int
+NearestPointBase<UserObjectType>::nearestUserObjectIndex(const Point & p) const
 {
   unsigned int closest = 0;
   Real closest_distance = std::numeric_limits<Real>::max();
@@ -162,7 +215,7 @@ NearestPointBase<UserObjectType>::nearestUserObject(const Point & p) const
     }
   }
 
-  return _user_objects[closest];
+  return closest;
 }
 
 #endif
@@ -37,6 +37,11 @@ class NearestPointLayeredAverage : public NearestPointBase<LayeredAverage>
 {
 public:
   NearestPointLayeredAverage(const InputParameters & parameters);
+
+  /**
+   * Sums the layers of all of the LayeredAverage objects in a single reduction
+   */
+  virtual void finalize() override;
 };
 
 #endif
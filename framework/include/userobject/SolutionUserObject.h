@@ -31,6 +31,7 @@ class NumericVector;
 
 // Forward declarations
 class SolutionUserObject;
+class CompressedFieldReader;
 
 template <>
 InputParameters validParams<SolutionUserObject>();
@@ -235,6 +236,26 @@ protected:
    */
   void readExodusII();
 
+  /**
+   * Method for reading a compressed field file (*.mcf) and the ExodusII mesh file it refers to
+   */
+  void readCompressedFields();
+
+  /**
+   * Set up the systems and copy the time step(s) after the ExodusII or compressed field file was
+   * opened, _exodus_times must point to the times of the file.
+   * @param all_nodal The names of the nodal variables in the file
+   * @param all_elemental The names of the elemental variables in the file
+   */
+  void readTimeSteps(const std::vector<std::string> & all_nodal,
+                     const std::vector<std::string> & all_elemental);
+
+  /**
+   * Copy a variable of a time step (one based) from the ExodusII or compressed field file
+   */
+  void copyNodalSolution(System & system, const std::string & var_name, int timestep);
+  void copyElementalSolution(System & system, const std::string & var_name, int timestep);
+
   /**
    * Method for extracting value of solution based on the DOF,
    * this is called by the public overloaded function that accept
@@ -304,7 +325,7 @@ protected:
   std::map<const Elem *, RealGradient> evalMultiValuedMeshFunctionGradient(
       const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
 
-  /// File type to read (0 = xda; 1 = ExodusII)
+  /// File type to read (0 = xda; 1 = ExodusII; 2 = xdr; 3 = compressed fields)
   MooseEnum _file_type;
 
   /// The XDA or ExodusII file that is being read
@@ -346,6 +367,9 @@ protected:
   /// Pointer to the libMesh::ExodusII used to read the files
   std::unique_ptr<ExodusII_IO> _exodusII_io;
 
+  /// The reader of a compressed field file, used in place of _exodusII_io
+  std::unique_ptr<CompressedFieldReader> _compressed_reader;
+
   /// Pointer to the serial solution vector
   std::unique_ptr<NumericVector<Number>> _serialized_solution;
 
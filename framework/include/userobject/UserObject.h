@@ -102,6 +102,20 @@ public:
     mooseError(name(), " does not satisfy the Spatial UserObject interface!");
   }
 
+  /**
+   * Evaluate the UserObject at a batch of spatial positions.  The default calls
+   * spatialValue() for each point; objects that can look up many points at once override this.
+   *
+   * @param points The points to evaluate at.
+   * @param values The value at each point (output).
+   */
+  virtual void spatialValues(const std::vector<Point> & points, std::vector<Real> & values) const
+  {
+    values.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+      values[i] = spatialValue(points[i]);
+  }
+
   /**
    * Must override.
    *
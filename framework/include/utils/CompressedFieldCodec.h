@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDFIELDCODEC_H
+#define COMPRESSEDFIELDCODEC_H
+
+#include "Moose.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Compression of a field (the values of one variable at one time step) against the reference
+ * values of the previous output step, used by CompressedFieldWriter and CompressedFieldReader.
+ *
+ * Slowly changing fields have small differences to the reference:
+ *   - lossless blocks store the XOR of the bits of each value and its reference, without the
+ *     leading zero bytes;
+ *   - lossy blocks store the difference quantized to steps of the error bound as variable length
+ *     integers, the decoded values differ from the written ones by at most the bound.
+ *
+ * The reference is updated to the decoded values on both sides, so lossy errors do not add up over
+ * the time steps. An empty reference (or one of a different size) is treated as zero.
+ */
+namespace CompressedFieldCodec
+{
+/**
+ * Append the encoded values to the buffer.
+ * @param values The values to encode
+ * @param reference The reference values, replaced by the values the reader will decode
+ * @param error_bound The absolute error bound, zero for lossless compression. Blocks that can not
+ *                    be quantized within the bound (e.g. non finite values) are stored lossless.
+ * @param buffer The buffer to append to
+ */
+void encode(const std::vector<Real> & values,
+            std::vector<Real> & reference,
+            Real error_bound,
+            std::string & buffer);
+
+/**
+ * Decode the block starting at begin into the reference values.
+ * @return The end of the block
+ */
+const char * decode(const char * begin, const char * end, std::vector<Real> & reference);
+}
+
+#endif // COMPRESSEDFIELDCODEC_H
@@ -0,0 +1,120 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDFIELDREADER_H
+#define COMPRESSEDFIELDREADER_H
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// libMesh forward declarations
+namespace libMesh
+{
+class System;
+}
+
+/**
+ * Reads the compressed field files (*.mcf) written by CompressedFieldWriter, with an interface
+ * following ExodusII_IO so that it can be used in place of an ExodusII file.
+ *
+ * Opening the file only reads the header and the times, the values of a time step are decoded
+ * starting from the closest keyframe when requested. The last two decoded time steps are kept, so
+ * reading the time steps in increasing order (also in pairs for interpolation) decodes each step
+ * once.
+ */
+class CompressedFieldReader
+{
+public:
+  /// Open the file and read the variable names and times
+  CompressedFieldReader(const std::string & file_name);
+
+  /// The ExodusII file holding the mesh
+  const std::string & meshFile() const { return _mesh_file; }
+
+  const std::vector<std::string> & getNodalVarNames() const { return _nodal_names; }
+  const std::vector<std::string> & getElemVarNames() const { return _elemental_names; }
+
+  /// The times of the time steps
+  const std::vector<Real> & getTimeSteps() const { return _times; }
+  int getNumTimeSteps() const { return _times.size(); }
+
+  /**
+   * Copy a nodal variable into the solution of the system. The nodes of the system are found in
+   * the file by their ids, which are the ids ExodusII_IO assigns when reading the mesh file.
+   * @param system The system to copy into
+   * @param system_var_name The variable of the system
+   * @param file_var_name The variable in the file
+   * @param timestep The time step (one based)
+   */
+  void copyNodalSolution(System & system,
+                         const std::string & system_var_name,
+                         const std::string & file_var_name,
+                         int timestep);
+
+  /// Copy an elemental variable into the solution of the system, see copyNodalSolution()
+  void copyElementalSolution(System & system,
+                             const std::string & system_var_name,
+                             const std::string & file_var_name,
+                             int timestep);
+
+protected:
+  /// Read a string written with its length
+  std::string readString();
+
+  /// Read a list of ids written with its size and return the position of each id in the list
+  std::vector<std::size_t> readPositions();
+
+  /// The decoded values of a variable (index into the nodal, then elemental variables)
+  const std::vector<Real> & values(std::size_t var, int timestep);
+
+  /// Copy the values of a variable into the system, for nodes or elements
+  void copySolution(System & system,
+                    const std::string & system_var_name,
+                    const std::vector<Real> & values,
+                    bool nodal);
+
+  /// Position of a value in the file for a node or element id, invalid for ids not in the file
+  std::size_t position(const std::vector<std::size_t> & positions, dof_id_type id) const;
+
+  const std::string _file_name;
+  std::ifstream _in;
+
+  std::string _mesh_file;
+  std::vector<std::string> _nodal_names;
+  std::vector<std::string> _elemental_names;
+
+  /// The position of the values of each node and element (indexed by id) in the file
+  std::vector<std::size_t> _node_positions;
+  std::vector<std::size_t> _elem_positions;
+
+  /// The time, position and size in the file and keyframe flag of each time step
+  std::vector<Real> _times;
+  std::vector<std::uint64_t> _offsets;
+  std::vector<std::uint64_t> _sizes;
+  std::vector<bool> _keyframes;
+
+  /// The last decoded time step (zero based) and its values, -1 if none
+  int _decoded_step;
+  std::vector<std::vector<Real>> _values;
+
+  /// The time step decoded before _decoded_step and its values, -1 if none
+  int _previous_step;
+  std::vector<std::vector<Real>> _previous_values;
+};
+
+#endif // COMPRESSEDFIELDREADER_H
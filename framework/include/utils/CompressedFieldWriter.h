@@ -0,0 +1,111 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDFIELDWRITER_H
+#define COMPRESSEDFIELDWRITER_H
+
+#include "MooseTypes.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * Writes the time steps of nodal and elemental variables into a compressed field file (*.mcf),
+ * read by CompressedFieldReader.
+ *
+ * The mesh is not part of the file, the header names an ExodusII mesh file next to it. Nodal and
+ * elemental values are stored in the order of the nodes and elements in the mesh file, the header
+ * holds the ids of the nodes and elements in that order (the node and element number maps of the
+ * mesh file) so that the reader does not depend on the numbering of its mesh.
+ *
+ * File layout (native byte order):
+ *   header: "MCF1", mesh file, nodal variable names, elemental variable names, node ids, element
+ *           ids (strings as uint32 length and characters, name lists as uint32 size and entries,
+ *           id lists as uint64 size and uint64 entries)
+ *   each time step: uint8 keyframe flag, double time, uint64 size, then one
+ *                   CompressedFieldCodec block per nodal and per elemental variable
+ *
+ * The blocks are encoded against the previous time step, except for keyframes which make every
+ * keyframe_interval-th step readable without decoding the steps before it.
+ */
+class CompressedFieldWriter
+{
+public:
+  /**
+   * Create the file and write the header.
+   * @param file_name The field file
+   * @param mesh_file The mesh file, relative to the directory of the field file
+   * @param nodal_names The names of the nodal variables
+   * @param elemental_names The names of the elemental variables
+   * @param node_ids The (zero based) ids of the nodes in the order of the mesh file
+   * @param elem_ids The (zero based) ids of the elements in the order of the mesh file
+   * @param error_bound The absolute error bound, zero for lossless compression
+   * @param keyframe_interval The number of time steps between keyframes
+   */
+  CompressedFieldWriter(const std::string & file_name,
+                        const std::string & mesh_file,
+                        const std::vector<std::string> & nodal_names,
+                        const std::vector<std::string> & elemental_names,
+                        const std::vector<dof_id_type> & node_ids,
+                        const std::vector<dof_id_type> & elem_ids,
+                        Real error_bound,
+                        unsigned int keyframe_interval);
+
+  /**
+   * Append a time step, the values are given per variable in the order of the names and per node
+   * or element in the order of the ids given to the constructor
+   */
+  void write(Real time,
+             const std::vector<std::vector<Real>> & nodal_values,
+             const std::vector<std::vector<Real>> & elemental_values);
+
+  /// Number of time steps written
+  unsigned int numSteps() const { return _num_steps; }
+
+  /// Size of the written values without compression
+  std::size_t rawBytes() const { return _raw_bytes; }
+
+  /// Size of the written time steps
+  std::size_t writtenBytes() const { return _written_bytes; }
+
+  /// Total time spent compressing and writing
+  Real writeTime() const { return _write_time; }
+
+protected:
+  /// Write a string with its length
+  void writeString(const std::string & value);
+
+  /// Write a list of ids with its size
+  void writeIds(const std::vector<dof_id_type> & ids);
+
+  const std::string _file_name;
+  const Real _error_bound;
+  const unsigned int _keyframe_interval;
+
+  std::ofstream _out;
+
+  /// The values the reader decodes for the previous time step (nodal, then elemental variables)
+  std::vector<std::vector<Real>> _references;
+
+  /// Buffer for the time step being written
+  std::string _buffer;
+
+  unsigned int _num_steps;
+  std::size_t _raw_bytes;
+  std::size_t _written_bytes;
+  Real _write_time;
+};
+
+#endif // COMPRESSEDFIELDWRITER_H
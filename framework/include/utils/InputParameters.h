@@ -24,6 +24,8 @@
 #include "libmesh/parameters.h"
 #include "libmesh/parsed_function.h"
 
+#include <memory>
+
 #ifdef LIBMESH_HAVE_FPARSER
 #include "libmesh/fparser.hh"
 #else
@@ -680,18 +682,32 @@ private:
   template <typename T, typename S>
   void setParamHelper(const std::string & name, T & l_value, const S & r_value);
 
-  /// The documentation strings for each parameter
-  std::map<std::string, std::string> _doc_string;
+  /**
+   * The documentation of the parameters, which is only needed for error messages and the syntax
+   * dumps. It is shared between copies until one of them changes it, so copying the parameters of
+   * the many objects built at startup does not copy the documentation strings.
+   */
+  struct Documentation
+  {
+    /// The documentation strings for each parameter
+    std::map<std::string, std::string> _doc_string;
+
+    /// The custom type that will be printed in the YAML dump for a parameter if supplied
+    std::map<std::string, std::string> _custom_type;
+
+    /// The names of the parameters organized into groups
+    std::map<std::string, std::string> _group;
+  };
 
-  /// The custom type that will be printed in the YAML dump for a parameter if supplied
-  std::map<std::string, std::string> _custom_type;
+  /// The documentation to change, copied first if it is shared with another object
+  Documentation & writableDocumentation();
+
+  /// The documentation, possibly shared with copies of this object
+  std::shared_ptr<Documentation> _documentation;
 
   /// Syntax for command-line parameters
   std::map<std::string, std::vector<std::string>> _syntax;
 
-  /// The names of the parameters organized into groups
-  std::map<std::string, std::string> _group;
-
   /// The map of functions used for range checked parameters
   std::map<std::string, std::string> _range_functions;
 
@@ -952,7 +968,7 @@ InputParameters::addRequiredParam(const std::string & name, const std::string &
 
   InputParameters::insert<T>(name);
   _required_params.insert(name);
-  _doc_string[name] = doc_string;
+  writableDocumentation()._doc_string[name] = doc_string;
 }
 
 template <typename T>
@@ -972,7 +988,7 @@ InputParameters::addParam(const std::string & name, const S & value, const std::
   checkConsistentType<T>(name);
 
   T & l_value = InputParameters::set<T>(name);
-  _doc_string[name] = doc_string;
+  writableDocumentation()._doc_string[name] = doc_string;
 
   // Set the parameter now
   setParamHelper(name, l_value, value);
@@ -990,7 +1006,7 @@ InputParameters::addParam(const std::string & name, const std::string & doc_stri
   checkConsistentType<T>(name);
 
   InputParameters::insert<T>(name);
-  _doc_string[name] = doc_string;
+  writableDocumentation()._doc_string[name] = doc_string;
 }
 
 template <typename T, typename S>
@@ -1038,7 +1054,7 @@ InputParameters::addRequiredCustomTypeParam(const std::string & name,
                                             const std::string & doc_string)
 {
   addRequiredParam<T>(name, doc_string);
-  _custom_type[name] = custom_type;
+  writableDocumentation()._custom_type[name] = custom_type;
 }
 
 template <typename T>
@@ -1049,7 +1065,7 @@ InputParameters::addCustomTypeParam(const std::string & name,
                                     const std::string & doc_string)
 {
   addParam<T>(name, value, doc_string);
-  _custom_type[name] = custom_type;
+  writableDocumentation()._custom_type[name] = custom_type;
 }
 
 template <typename T>
@@ -1059,7 +1075,7 @@ InputParameters::addCustomTypeParam(const std::string & name,
                                     const std::string & doc_string)
 {
   addParam<T>(name, doc_string);
-  _custom_type[name] = custom_type;
+  writableDocumentation()._custom_type[name] = custom_type;
 }
 
 template <typename T>
@@ -20,6 +20,7 @@
 #include "DataIO.h"
 
 #include <unordered_map>
+#include <initializer_list>
 
 // External library includes
 #include "randistrs.h"
@@ -75,6 +76,29 @@ public:
    */
   static inline uint32_t randl() { return mt_lrand(); }
 
+  /**
+   * Counter based random number: hashes the given counters (e.g. seed, sample, step) in turn with
+   * the SplitMix64 finalizer. The number depends only on the counters, so it is reproducible
+   * regardless of the order in which (or the processor on which) the numbers are drawn.
+   * @param counters  the counters identifying the random number
+   * @return      a random number in the range [0,1) with 53-bit precision
+   */
+  static inline double counterRand(std::initializer_list<uint64_t> counters)
+  {
+    uint64_t key = 0;
+    for (uint64_t counter : counters)
+    {
+      key ^= counter;
+      key += 0x9e3779b97f4a7c15ULL;
+      key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+      key ^= key >> 31;
+    }
+
+    // The upper 53 bits give a uniformly distributed double
+    return (key >> 11) * (1.0 / 9007199254740992.0);
+  }
+
   /**
    * The method seeds one of the independent random number generators
    * @param i     the index of the generator
@@ -18,6 +18,10 @@
 // MOOSE includes
 #include "MooseTypes.h"
 
+// libMesh includes
+#include "libmesh/vector_value.h"
+#include "libmesh/point.h"
+
 // Forward declarations
 class LineSegment;
 class MooseMesh;
@@ -27,12 +31,43 @@ namespace libMesh
 class Elem;
 class MeshBase;
 class Plane;
-class Point;
 class PointLocatorBase;
 }
 
 namespace Moose
 {
+/**
+ * Outward facing planes of the sides of the active affine elements of a (replicated) mesh.
+ *
+ * Building these once lets many lines be traced through the same mesh without touching the
+ * element geometry again.  The sides of other elements may not be planar, they are intersected
+ * exactly instead.  Must be rebuilt when the mesh changes.
+ */
+class ElemSidePlanes
+{
+public:
+  ElemSidePlanes(const MeshBase & mesh);
+
+  /**
+   * Get the plane of a side
+   * @param elem The element, which must be affine
+   * @param side The side of elem
+   * @param origin A point on the side (output)
+   * @param normal The outward normal of the side, not normalized (output)
+   */
+  void get(const Elem * elem, unsigned int side, Point & origin, RealVectorValue & normal) const;
+
+private:
+  /// Index of the first side of each element in _origins and _normals, indexed by element id
+  std::vector<dof_id_type> _offsets;
+
+  /// A point on every side
+  std::vector<Point> _origins;
+
+  /// The outward normal of every side
+  std::vector<RealVectorValue> _normals;
+};
+
 /**
  * Find all of the elements intersected by a line.
  * The line is given as the beginning and ending points
@@ -48,6 +83,21 @@ void elementsIntersectedByLine(const Point & p0,
                                const PointLocatorBase & point_locator,
                                std::vector<Elem *> & intersected_elems,
                                std::vector<LineSegment> & segments);
+
+/**
+ * Find the elements intersected by each one of a batch of lines.  The side planes of the mesh are
+ * computed once and shared by all lines.
+ * @param starts The beginnings of the lines
+ * @param ends The ends of the lines
+ * @param intersected_elems The elements intersected by each line
+ * @param segments The line segments across each element for each line
+ */
+void elementsIntersectedByLines(const std::vector<Point> & starts,
+                                const std::vector<Point> & ends,
+                                const MeshBase & mesh,
+                                const PointLocatorBase & point_locator,
+                                std::vector<std::vector<Elem *>> & intersected_elems,
+                                std::vector<std::vector<LineSegment>> & segments);
 }
 
 #endif // RAYTRACING_H
@@ -24,7 +24,7 @@ template <>
 InputParameters validParams<ElementsAlongLine>();
 
 /**
- * Get all of the elements that are intersected by a line
+ * Get all of the elements that are intersected by a line, or by each line of a batch
  */
 class ElementsAlongLine : public GeneralVectorPostprocessor
 {
@@ -39,14 +39,17 @@ public:
   virtual void execute() override;
 
 protected:
-  /// The beginning of the line
-  Point _start;
+  /// The beginnings of the lines
+  std::vector<Point> _starts;
 
-  /// The end of the line
-  Point _end;
+  /// The ends of the lines
+  std::vector<Point> _ends;
 
-  /// The elements that intersect the line
+  /// The elements that intersect the lines
   VectorPostprocessorValue & _elem_ids;
+
+  /// The line each element was found along, only declared for a batch of lines
+  VectorPostprocessorValue * _line_ids;
 };
 
 #endif
@@ -23,6 +23,10 @@ public:
   GapHeatPointSourceMaster(const InputParameters & parameters);
 
   virtual void addPoints();
+
+  /// Assembles all points in the current element at once
+  virtual void computeResidual();
+
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
@@ -31,6 +35,13 @@ protected:
   std::map<Point, PenetrationInfo *> point_to_info;
   NumericVector<Number> & _slave_flux;
 
+  ///@{ Work vectors for computeResidual()
+  std::vector<numeric_index_type> _point_dofs;
+  std::vector<unsigned int> _point_qps;
+  std::vector<Real> _point_multiplicities;
+  std::vector<Number> _point_fluxes;
+  ///@}
+
   //  std::vector<Real> _localized_slave_flux;
 };
 
@@ -42,14 +42,21 @@ public:
   // Interface functions for the EBSDReader
   const EBSDMeshGeometry & getEBSDGeometry() const { return _geometry; }
   const std::string & getEBSDFilename() const { return _filename; }
+  bool isBinaryEBSDFile() const { return _binary; }
 
 protected:
   /// Read the EBSD data file header
   void readEBSDHeader();
 
+  /// Read the header of a binary EBSD data file
+  void readBinaryEBSDHeader();
+
   /// Name of the file containing the EBSD data
   std::string _filename;
 
+  /// Whether the EBSD data file is in the binary format
+  bool _binary;
+
   /// EBSD data file mesh information
   EBSDMeshGeometry _geometry;
 };
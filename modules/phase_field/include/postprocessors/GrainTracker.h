@@ -10,6 +10,7 @@
 
 #include "FeatureFloodCount.h"
 #include "GrainTrackerInterface.h"
+#include "BoundingBoxTree.h"
 
 // libMesh includes
 #include "libmesh/mesh_tools.h"
@@ -117,9 +118,17 @@ protected:
   void broadcastAndUpdateGrainData();
 
   /**
-   * Populates and sorts a min_distances vector with the minimum distances to all grains in the
+   * Rebuilds _grain_box_tree from the bounding boxes of the grains in _feature_sets.
+   * This method should only be called on the root processor
+   */
+  void buildGrainBoxTree();
+
+  /**
+   * Populates and sorts a min_distances vector with the minimum distances to the grains in the
    * simulation for a given grain. There are _vars.size() entries in the outer vector, one for
-   * each order parameter. A list of grains with the same OP are ordered in lists per OP.
+   * each order parameter. A list of grains with the same OP are ordered in lists per OP. Only
+   * the grains near the given grain are inserted: all grains overlapping it and at least the
+   * closest grain of each OP.
    */
   void computeMinDistancesFromGrain(FeatureData & grain,
                                     std::vector<std::list<GrainDistance>> & min_distances);
@@ -221,6 +230,13 @@ protected:
    */
   bool _error_on_grain_creation;
 
+  /**
+   * Spatial index of the bounding boxes of the grains in _feature_sets (by index) used to find
+   * the candidates for matching, splitting and remapping without comparing all pairs of grains.
+   * Only built on the root processor.
+   */
+  BoundingBoxTree _grain_box_tree;
+
 private:
   /// Holds the first unique grain index when using _reserve_op (all the remaining indices are sequential)
   unsigned int _reserve_grain_first_index;
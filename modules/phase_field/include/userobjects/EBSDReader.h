@@ -10,7 +10,14 @@
 #include "EulerAngleProvider.h"
 #include "EBSDAccessFunctors.h"
 
+#include "libmesh/threads.h"
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+
 class EBSDReader;
+class EBSDBinaryFile;
 
 template <>
 InputParameters validParams<EBSDReader>();
@@ -138,6 +145,23 @@ protected:
   /// Logically three-dimensional data indexed by geometric points in a 1D vector
   std::vector<EBSDPointData> _data;
 
+  /// Only keep the data points in the box around the local elements in _data
+  const bool _local_data;
+
+  /// Mapping of a binary EBSD file without local_data, getData() reads from it instead of _data
+  std::unique_ptr<EBSDBinaryFile> _binary_file;
+
+  /// The points of _binary_file converted by getData() so far, indexed by global grid index
+  mutable std::unordered_map<unsigned int, EBSDPointData> _binary_data;
+
+  /// Guards the insertion into _binary_data by getData()
+  mutable Threads::spin_mutex _binary_data_mutex;
+
+  ///@{ Lower corner and size (in grid points) of the box stored in _data if _local_data is set
+  std::array<unsigned int, 3> _local_min;
+  std::array<unsigned int, 3> _local_n;
+  ///@}
+
   /// Averages by (global) grain ID
   std::vector<EBSDAvgData> _avg_data;
 
@@ -174,9 +198,30 @@ protected:
   /// Maximum grid extent
   Real _maxx, _maxy, _maxz;
 
-  /// Computes a global index in the _data array given an input *centroid* point
+  /// Read the data points from a text EBSD file
+  void readTextFile(const std::string & filename);
+
+  /// Read the data points from a (memory mapped) binary EBSD file
+  void readBinaryFile(const std::string & filename);
+
+  /// Copy the data points in the box around the local elements out of a binary EBSD file
+  void readLocalData(const EBSDBinaryFile & file);
+
+  /// Convert the binary record of the point with the given grid index
+  void readPoint(const EBSDBinaryFile & file, unsigned int global_index, EBSDPointData & d) const;
+
+  ///@{ Accumulate the grain averages from the data points
+  void initAvgData();
+  void addToAvgData(const EBSDPointData & d);
+  void finalizeAvgData();
+  ///@}
+
+  /// Computes a global index into the EBSD grid given an input *centroid* point
   unsigned indexFromPoint(const Point & p) const;
 
+  /// Index into the _data array for a global index into the EBSD grid
+  unsigned localIndex(unsigned int global_index) const;
+
   /// Transfer the index into the _avg_data array from given index
   unsigned indexFromIndex(unsigned int var) const;
 
@@ -10,6 +10,7 @@
 #include <array>
 #include "PolycrystalUserObjectBase.h"
 #include "DelimitedFileReader.h"
+#include "GrainCenterGrid.h"
 
 // Forward Declarations
 class PolycrystalCircles;
@@ -50,6 +51,12 @@ protected:
 
   std::vector<Point> _centerpoints; // x,y,z coordinates of circle centers
   std::vector<Real> _radii;         // Radius for each circular grain created
+
+  /// Largest circle radius, the search radius for the circles around a point
+  Real _max_radius;
+
+  /// Spatial index of _centerpoints for finding the circles around a point
+  GrainCenterGrid _center_grid;
 };
 
 #endif // POLYCRYSTALCIRCLES_H
@@ -11,6 +11,8 @@
 
 #include "libmesh/dense_matrix.h"
 
+#include <array>
+
 // Forward Declarations
 class PolycrystalUserObjectBase;
 
@@ -132,6 +134,12 @@ protected:
    */
   void printGrainAdjacencyMatrix() const;
 
+  /**
+   * Returns the periodicity of the coupled variables in each direction, e.g. for building a
+   * GrainCenterGrid.
+   */
+  std::array<bool, LIBMESH_DIM> periodicDirections() const;
+
   /*************************************************
    *************** Data Structures *****************
    ************************************************/
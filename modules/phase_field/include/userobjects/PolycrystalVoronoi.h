@@ -8,6 +8,7 @@
 #define POLYCRYSTALVORONOI_H
 
 #include "PolycrystalUserObjectBase.h"
+#include "GrainCenterGrid.h"
 
 // Forward Declarations
 class PolycrystalVoronoi;
@@ -40,6 +41,9 @@ protected:
   Point _range;
 
   std::vector<Point> _centerpoints;
+
+  /// Spatial index of _centerpoints for closest grain lookups
+  GrainCenterGrid _center_grid;
 };
 
 #endif // POLYCRYSTALVORONOI_H
@@ -0,0 +1,77 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef BOUNDINGBOXTREE_H
+#define BOUNDINGBOXTREE_H
+
+#include "Moose.h"
+
+#include "libmesh/mesh_tools.h"
+
+/**
+ * Static bounding volume hierarchy over a set of axis aligned boxes, each tagged with an index
+ * (e.g. the index of the feature the box belongs to). Several boxes may share the same index.
+ * The tree is built once and answers "which indices have a box overlapping this region" queries
+ * by only descending into the subtrees whose bounds overlap the region.
+ */
+class BoundingBoxTree
+{
+public:
+  BoundingBoxTree();
+
+  /// Remove all boxes
+  void clear();
+
+  /// Add a box with the given index, build() must be called before the next query
+  void addBox(const MeshTools::BoundingBox & box, std::size_t index);
+
+  /// Build the hierarchy over all boxes added so far
+  void build();
+
+  /**
+   * Collect (in ascending order, without duplicates) the indices of all boxes that overlap any
+   * of the given boxes inflated by the given distance in every direction. Touching boxes are
+   * counted as overlapping.
+   */
+  void query(const std::vector<MeshTools::BoundingBox> & boxes,
+             Real inflation,
+             std::vector<std::size_t> & indices) const;
+
+  /// Bounds of all boxes in the tree
+  const MeshTools::BoundingBox & bounds() const;
+
+  bool empty() const { return _boxes.empty(); }
+
+protected:
+  struct Node
+  {
+    MeshTools::BoundingBox _bounds;
+
+    /// Range of _boxes in this node (leaves) or the index of the second child (inner nodes)
+    std::size_t _begin;
+    std::size_t _end;
+
+    /// The first child of an inner node is always the next node
+    bool _leaf;
+  };
+
+  /// Recursively build the subtree over _boxes[begin, end), returns its node index
+  std::size_t buildNode(std::size_t begin, std::size_t end);
+
+  /// Append the indices of all boxes overlapping the box [min, max]
+  void queryBox(const Point & min, const Point & max, std::vector<std::size_t> & indices) const;
+
+  /// Do two boxes overlap (inclusive)?
+  static bool overlaps(const MeshTools::BoundingBox & box, const Point & min, const Point & max);
+
+  std::vector<std::pair<MeshTools::BoundingBox, std::size_t>> _boxes;
+  std::vector<Node> _nodes;
+
+  /// Maximum number of boxes in a leaf
+  static constexpr std::size_t _leaf_size = 8;
+};
+
+#endif // BOUNDINGBOXTREE_H
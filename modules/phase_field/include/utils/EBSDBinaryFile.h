@@ -0,0 +1,109 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EBSDBINARYFILE_H
+#define EBSDBINARYFILE_H
+
+#include "Moose.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Read only, memory mapped view of a binary EBSD data file as written by
+ * modules/phase_field/scripts/ebsd_to_binary.py. Mapping the file (rather than reading it)
+ * lets all ranks on a node share the same pages of the operating system page cache.
+ *
+ * File layout (little endian):
+ *  * Header
+ *  * n_features uint32 feature ids in the order of their first appearance in the text file,
+ *    padded to a multiple of 8 bytes
+ *  * n_points records (a PointRecord followed by custom_columns doubles) in the [z][y][x]
+ *    order of the EBSD grid
+ */
+class EBSDBinaryFile
+{
+public:
+  /// Magic bytes at the beginning of every binary EBSD file
+  static constexpr char magic[8] = {'M', 'O', 'O', 'S', 'E', 'B', 'S', 'D'};
+
+  /// Version of the file layout
+  static constexpr uint32_t version = 1;
+
+  struct Header
+  {
+    char _magic[8];
+    uint32_t _version;
+    uint32_t _dim;
+    uint32_t _n[3];
+    uint32_t _custom_columns;
+    uint64_t _n_features;
+    uint64_t _n_points;
+    double _d[3];
+    double _min[3];
+  };
+
+  /// Fixed size part of the data of a single EBSD point, the angles are stored in radians
+  struct PointRecord
+  {
+    double _phi1;
+    double _Phi;
+    double _phi2;
+    double _x;
+    double _y;
+    double _z;
+    uint32_t _feature_id;
+    uint32_t _phase;
+    uint32_t _symmetry;
+    uint32_t _padding;
+  };
+
+  /// Map the given file, errors out if it is not a valid binary EBSD file
+  EBSDBinaryFile(const std::string & filename);
+  ~EBSDBinaryFile();
+
+  EBSDBinaryFile(const EBSDBinaryFile &) = delete;
+  EBSDBinaryFile & operator=(const EBSDBinaryFile &) = delete;
+
+  /// Check the magic bytes of a file to see if it is a binary EBSD file
+  static bool isBinary(const std::string & filename);
+
+  const Header & header() const { return *_header; }
+
+  /// Feature id of the i-th feature (in order of appearance)
+  uint32_t featureID(std::size_t i) const { return _feature_ids[i]; }
+
+  /// Fixed size data of the point with the given [z][y][x] grid index
+  const PointRecord & point(std::size_t i) const
+  {
+    return *reinterpret_cast<const PointRecord *>(_points + i * _record_size);
+  }
+
+  /// Custom data columns of the point with the given [z][y][x] grid index
+  const double * custom(std::size_t i) const
+  {
+    return reinterpret_cast<const double *>(_points + i * _record_size + sizeof(PointRecord));
+  }
+
+protected:
+  const std::string _filename;
+
+  ///@{ The memory mapping
+  void * _mapping;
+  std::size_t _mapping_size;
+  ///@}
+
+  ///@{ Pointers into the mapping
+  const Header * _header;
+  const uint32_t * _feature_ids;
+  const char * _points;
+  ///@}
+
+  /// Size of one point record in bytes
+  std::size_t _record_size;
+};
+
+#endif // EBSDBINARYFILE_H
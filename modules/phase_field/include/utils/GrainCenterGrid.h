@@ -0,0 +1,91 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef GRAINCENTERGRID_H
+#define GRAINCENTERGRID_H
+
+#include "Moose.h"
+
+#include "libmesh/point.h"
+
+#include <array>
+
+/**
+ * Bucket grid over a set of grain center points in a box shaped domain that may be periodic
+ * in any of its directions. It answers closest center and radius queries by only visiting the
+ * buckets around the query point (including the periodic images of the point) instead of all
+ * centers.
+ *
+ * Distances are computed with the same arithmetic as MooseMesh::minPeriodicDistance(), so
+ * the results are identical to a brute force search over all centers.
+ */
+class GrainCenterGrid
+{
+public:
+  GrainCenterGrid();
+
+  /**
+   * Bin the center points.
+   * @param centers The grain center points, copied into the grid
+   * @param bottom_left The lower corner of the domain
+   * @param top_right The upper corner of the domain
+   * @param periodic Whether the domain is periodic in each direction
+   */
+  void build(const std::vector<Point> & centers,
+             const Point & bottom_left,
+             const Point & top_right,
+             const std::array<bool, LIBMESH_DIM> & periodic);
+
+  /**
+   * Index of the center closest to a point. Ties go to the lowest index.
+   */
+  unsigned int closestCenter(const Point & p) const;
+
+  /**
+   * Collect (in ascending order) the indices of the centers that may lie within a radius of a
+   * point. This is a superset of the centers within the radius, the caller applies the exact
+   * distance check.
+   */
+  void candidateCenters(const Point & p, Real radius, std::vector<unsigned int> & centers) const;
+
+  /**
+   * Distance between a center and a point, taking the shortest periodic image.
+   */
+  Real distance(const Point & center, const Point & p) const;
+
+protected:
+  /// Bucket coordinate of a point in the given direction
+  int bucketCoordinate(const Point & p, unsigned int dim) const;
+
+  /**
+   * Range of bucket offsets from the bucket with the given coordinate in one direction. In
+   * periodic directions every bucket is reachable through exactly one offset in the range.
+   */
+  void offsetRange(int coord, unsigned int dim, int & lo, int & hi) const;
+
+  /// Index of the bucket at an offset from a base bucket, wrapping in periodic directions
+  unsigned int bucketIndex(const std::array<int, LIBMESH_DIM> & base,
+                           const std::array<int, LIBMESH_DIM> & offset) const;
+
+  std::vector<Point> _centers;
+
+  Point _bottom_left;
+  Point _half_range;
+  std::array<bool, LIBMESH_DIM> _periodic;
+
+  /// Number and size of the buckets in each direction
+  std::array<int, LIBMESH_DIM> _n_buckets;
+  std::array<Real, LIBMESH_DIM> _bucket_size;
+
+  /// Smallest bucket size over the directions with more than one bucket
+  Real _min_bucket_size;
+
+  /// Offsets into _bucket_centers for each bucket (CSR layout, x fastest)
+  std::vector<unsigned int> _bucket_offsets;
+  std::vector<unsigned int> _bucket_centers;
+};
+
+#endif // GRAINCENTERGRID_H
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+"""
+Convert a DREAM.3D text EBSD data file (as read by EBSDMesh and EBSDReader) into the binary
+EBSD format. The binary file is memory mapped by the EBSDReader, which avoids parsing the text
+on every rank and allows the reader to keep only the data around the local elements in memory
+(local_data = true).
+
+The layout is documented in modules/phase_field/include/utils/EBSDBinaryFile.h.
+"""
+from __future__ import print_function
+import sys
+import struct
+import argparse
+
+MAGIC = b'MOOSEBSD'
+VERSION = 1
+
+# Labels looked for in the header, see EBSDMesh::readEBSDHeader()
+LABELS = ['x_step', 'x_dim', 'y_step', 'y_dim', 'z_step', 'z_dim', 'x_min', 'y_min', 'z_min']
+
+HEADER_FORMAT = '<8sIIIIII QQ 3d3d'
+POINT_FORMAT = '<6d4I'
+
+
+def read_header(lines):
+    """
+    Parse the comment lines at the top of the file into the grid geometry.
+    """
+    values = [0.0] * len(LABELS)
+    for line in lines:
+        if not line.startswith('#'):
+            break
+
+        line = line.lower()
+        for i, label in enumerate(LABELS):
+            if label in line:
+                values[i] = float(line.split()[2])
+                break
+
+    d = [values[0], values[2], values[4]]
+    n = [int(values[1]), int(values[3]), int(values[5])]
+    lower = [values[6], values[7], values[8]]
+
+    dim = 3
+    while dim > 0 and n[dim - 1] == 0:
+        dim -= 1
+
+    if dim == 0:
+        raise ValueError('Error reading header, EBSD data is zero dimensional.')
+    for i in range(dim):
+        if n[i] == 0:
+            raise ValueError('Error reading header, EBSD grid size is zero.')
+        if d[i] == 0.0:
+            raise ValueError('Error reading header, EBSD data step size is zero.')
+
+    return dim, d, n, lower
+
+
+def convert(text_file, binary_file, custom_columns=None):
+    with open(text_file) as f:
+        lines = f.read().splitlines()
+
+    dim, d, n, lower = read_header(lines)
+    upper = [lower[i] + d[i] * n[i] for i in range(3)]
+    total_size = n[0] * n[1] * (n[2] if dim == 3 else 1)
+
+    points = [None] * total_size
+    features = []
+    known_features = set()
+
+    for line in lines:
+        if line.startswith('#'):
+            continue
+
+        columns = line.split()
+        if not columns:
+            continue
+
+        if custom_columns is None:
+            custom_columns = len(columns) - 9
+        if len(columns) < 9 + custom_columns:
+            raise ValueError('Unable to read in EBSD custom data columns:\n' + line)
+
+        phi1, Phi, phi2, x, y, z = [float(c) for c in columns[0:6]]
+        feature_id, phase, symmetry = [int(c) for c in columns[6:9]]
+        custom = [float(c) for c in columns[9:9 + custom_columns]]
+
+        if x < lower[0] or y < lower[1] or x > upper[0] or y > upper[1] or \
+           (dim == 3 and (z < lower[2] or z > upper[2])):
+            raise ValueError('EBSD Data outside of the domain declared in the header\n' + line)
+
+        # Same grid index as EBSDReader::indexFromPoint()
+        index = int((y - lower[1]) / d[1])
+        if dim == 3:
+            index += int((z - lower[2]) / d[2]) * n[1]
+        index = index * n[0] + int((x - lower[0]) / d[0])
+
+        # The reader numbers the grains in the order of their first appearance in the file
+        if feature_id not in known_features:
+            known_features.add(feature_id)
+            features.append(feature_id)
+
+        points[index] = (phi1, Phi, phi2, x, y, z, feature_id, phase, symmetry, custom)
+
+    if None in points:
+        raise ValueError('EBSD file %s does not contain a data point for grid point %d'
+                         % (text_file, points.index(None)))
+
+    with open(binary_file, 'wb') as f:
+        f.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, dim, n[0], n[1], n[2], custom_columns,
+                            len(features), total_size, d[0], d[1], d[2],
+                            lower[0], lower[1], lower[2]))
+
+        # Feature table, padded to 8 bytes
+        f.write(struct.pack('<%dI' % len(features), *features))
+        if len(features) % 2:
+            f.write(struct.pack('<I', 0))
+
+        for point in points:
+            f.write(struct.pack(POINT_FORMAT, *(point[0:9] + (0,))))
+            f.write(struct.pack('<%dd' % custom_columns, *point[9]))
+
+    print('Wrote %d points, %d features and %d custom columns to %s'
+          % (total_size, len(features), custom_columns, binary_file))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Convert a text EBSD data file to the binary '
+                                     'format read by the phase_field EBSDReader.')
+    parser.add_argument('text_file', help='The DREAM.3D text EBSD data file.')
+    parser.add_argument('binary_file', help='The binary EBSD data file to write.')
+    parser.add_argument('--custom-columns', type=int, default=None,
+                        help='Number of custom data columns to store (default: all columns '
+                        'after the nine standard columns).')
+    options = parser.parse_args()
+
+    try:
+        convert(options.text_file, options.binary_file, options.custom_columns)
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        sys.exit(1)
@@ -0,0 +1,57 @@
+# Startup benchmark: the GrainGrowth action builds the variables, kernels, and initial conditions
+# of all order parameters, so this short input constructs about a thousand objects. The test only
+# checks the input, which parses the file and builds all objects without solving, and prints the
+# setup time in the performance log.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmax = 400
+  ymax = 400
+  elem_type = QUAD
+[]
+
+[GlobalParams]
+  op_num = 200
+  var_name_base = gr
+[]
+
+[Modules]
+  [./PhaseField]
+    [./GrainGrowth]
+    [../]
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalRandomIC]
+      random_type = continuous
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./Copper]
+    type = GBEvolution
+    T = 500 # K
+    wGB = 60 # nm
+    GBmob0 = 2.5e-6 #m^4/(Js) from Schoenfelder 1997
+    Q = 0.23 #Migration energy in eV
+    GBenergy = 0.708 #GB energy in J/m^2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = bdf2
+  solve_type = 'PJFNK'
+  num_steps = 1
+  dt = 80.0
+[]
+
+[Outputs]
+  # The "Application Setup" row of the performance log is the startup time
+  print_perf_log = true
+[]
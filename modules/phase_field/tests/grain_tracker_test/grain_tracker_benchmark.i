@@ -0,0 +1,60 @@
+# Timing benchmark for grain tracking and remapping with 10^4 grains. The solve is
+# skipped, the GrainTracker still has to match every grain on every time step.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 400
+  ny = 400
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 25
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    grain_num = 10000
+    coloring_algorithm = jp
+    rand_seed = 10
+  [../]
+  [./grain_tracker]
+    type = GrainTracker
+    threshold = 0.2
+    connecting_threshold = 0.08
+    polycrystal_ic_uo = voronoi
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
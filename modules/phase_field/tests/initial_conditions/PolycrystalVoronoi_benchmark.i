@@ -0,0 +1,58 @@
+# Timing benchmark for the grain lookup of PolycrystalVoronoi with 10^4 grains
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 500
+  ny = 500
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 25
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    rand_seed = 105
+    grain_num = 10000
+    coloring_algorithm = jp
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./All]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
@@ -24,6 +24,9 @@
 #include "libmesh/elem.h"
 #include "libmesh/parallel_algebra.h"
 
+// C++ includes
+#include <unordered_map>
+
 // Forward Declarations
 class ElementLoopUserObject;
 
@@ -101,8 +104,26 @@ protected:
 
   /// true if we have cached interface elements, false if they need to be cached. We want to (re)cache only when mesh changed
   bool _have_interface_elems;
-  /// List of element IDs that are on the processor boundary and need to be send to other processors
-  std::set<dof_id_type> _interface_elem_ids;
+  /// IDs of the elements on the processor boundary, indexed by the processors they are sent to
+  std::map<processor_id_type, std::set<dof_id_type>> _interface_elem_ids;
+
+  /// index of the local elements and their neighbors into the compact data arrays, by element ID
+  std::unordered_map<dof_id_type, unsigned int> _elem_indices;
+
+  /// number the active local elements and their neighbors for the compact data arrays
+  void buildElemIndices();
+
+  /// index of an element into the compact data arrays, libMesh::invalid_uint if it has none
+  unsigned int elemIndex(dof_id_type elementid) const;
+
+  /// send the data of the interface elements to the processors of their neighbors only
+  void exchangeInterfaceData();
+
+  /// write the data of the given local elements into a buffer
+  virtual void serialize(const std::set<dof_id_type> & elem_ids, std::string & serialized_buffer);
+
+  /// load the data of the elements of another processor from a buffer
+  virtual void deserialize(const std::string & serialized_buffer);
 
   /// The subdomain for the current element
   SubdomainID _subdomain;
@@ -28,6 +28,11 @@ InputParameters validParams<InternalSideFluxBase>();
  *
  *   2. Derived classes need to provide computing of the fluxes and their jacobians,
  *      i.e., they need to implement `calcFlux` and `calcJacobian`.
+ *
+ *   3. Each thread caches the flux and the Jacobian of the last side it visited.
+ *      All the kernels on a side are evaluated by the same thread one after another,
+ *      so the flux and the Jacobian of a side are computed only once per evaluation
+ *      without any locking between threads.
  */
 class InternalSideFluxBase : public GeneralUserObject
 {
@@ -112,8 +117,13 @@ public:
                             DenseMatrix<Real> & jac2) const = 0;
 
 protected:
-  mutable unsigned int _cached_elem_id;
-  mutable unsigned int _cached_neig_id;
+  /// element and neighbor IDs of the side whose flux is cached on each thread
+  mutable std::vector<dof_id_type> _cached_flux_elem_id;
+  mutable std::vector<dof_id_type> _cached_flux_neig_id;
+
+  /// element and neighbor IDs of the side whose Jacobian is cached on each thread
+  mutable std::vector<dof_id_type> _cached_jacobian_elem_id;
+  mutable std::vector<dof_id_type> _cached_jacobian_neig_id;
 
   /// flux vector of this side
   mutable std::vector<std::vector<Real>> _flux;
@@ -121,9 +131,6 @@ protected:
   mutable std::vector<DenseMatrix<Real>> _jac1;
   /// Jacobian matrix contribution to the "right" cell
   mutable std::vector<DenseMatrix<Real>> _jac2;
-
-private:
-  static Threads::spin_mutex _mutex;
 };
 
 #endif // INTERNALSIDEFLUXBASE_H
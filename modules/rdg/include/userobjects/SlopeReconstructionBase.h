@@ -65,35 +65,38 @@ public:
   virtual void meshChanged();
 
 protected:
-  virtual void serialize(std::string & serialized_buffer);
-  virtual void deserialize(std::vector<std::string> & serialized_buffers);
+  virtual void serialize(const std::set<dof_id_type> & elem_ids, std::string & serialized_buffer);
+  virtual void deserialize(const std::string & serialized_buffer);
 
-  /// store the reconstructed slopes into this map indexed by element ID
-  std::map<dof_id_type, std::vector<RealGradient>> _rslope;
+  /// index of a local side of an element into the side data arrays
+  unsigned int sideIndex(dof_id_type elementid, unsigned int side) const;
 
-  /// store the average variable values into this map indexed by element ID
-  std::map<dof_id_type, std::vector<Real>> _avars;
+  /// index into the side data arrays of the side of an element shared with a neighbor
+  unsigned int neighborSideIndex(dof_id_type elementid, dof_id_type neighborid) const;
 
-  /// store the boundary average variable values into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, std::vector<Real>> _bnd_avars;
+  /// store the reconstructed slopes into this array indexed by elemIndex()
+  std::vector<std::vector<RealGradient>> _rslope;
 
-  /// store the side centroid into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Point> _side_centroid;
+  /// store the average variable values into this array indexed by elemIndex()
+  std::vector<std::vector<Real>> _avars;
 
-  /// store the boundary side centroid into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Point> _bnd_side_centroid;
+  /// store the boundary average variable values into this array indexed by sideIndex()
+  std::vector<std::vector<Real>> _bnd_avars;
 
-  /// store the side area into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Real> _side_area;
+  /// store the (internal and boundary) side centroids into this array indexed by sideIndex()
+  std::vector<Point> _side_centroid;
 
-  /// store the boundary side area into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Real> _bnd_side_area;
+  /// store the (internal and boundary) side areas into this array indexed by sideIndex()
+  std::vector<Real> _side_area;
 
-  /// store the side normal into this map indexed by pair of element ID and neighbor ID
-  std::map<std::pair<dof_id_type, dof_id_type>, Point> _side_normal;
+  /// store the (internal and boundary) side normals into this array indexed by sideIndex()
+  std::vector<Point> _side_normal;
 
-  /// store the boundary side normal into this map indexed by pair of element ID and local side ID
-  std::map<std::pair<dof_id_type, unsigned int>, Point> _bnd_side_normal;
+  /// offset of the first side of each local element (indexed by elemIndex()) in the side arrays
+  std::vector<unsigned int> _side_offsets;
+
+  /// whether the centroid, normal and area of a side are computed, indexed by sideIndex()
+  std::vector<bool> _side_geoinfo_computed;
 
   /// required data for face assembly
   const MooseArray<Point> & _q_point_face;
@@ -110,11 +113,9 @@ protected:
   /// the neighboring element
   const Elem *& _neighbor_elem;
 
-  /// flag to indicated if side geometry info is cached
-  bool _side_geoinfo_cached;
-
 private:
-  static Threads::spin_mutex _mutex;
+  /// size the data arrays for the current mesh and compute the side geometry of the local elements
+  void initDataStorage();
 };
 
 #endif
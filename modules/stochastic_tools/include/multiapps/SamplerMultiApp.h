@@ -11,20 +11,90 @@
 // MOOSE includes
 #include "TransientMultiApp.h"
 #include "SamplerInterface.h"
+#include "MooseEnum.h"
+
+// libMesh includes
+#include "libmesh/dense_matrix.h"
 
 class SamplerMultiApp;
 
 template <>
 InputParameters validParams<SamplerMultiApp>();
 
+/**
+ * Runs a sub-application for each row of each Sampler matrix.
+ *
+ * In the default "normal" mode one sub-application is created per sample and all of them are
+ * stepped together with the master. In "batch" mode only a pool of sub-applications, one per
+ * processor (or per group of processors if there are fewer samples than processors), is created.
+ * Each time the MultiApp executes, the pool runs every sample to completion: a sub-application
+ * takes the next sample from a work queue shared by all processors, restores the state it had
+ * after initialization, sets its "sample_receivers" to the sampled values and executes. Memory
+ * therefore scales with the pool size instead of the number of samples, and faster processors
+ * simply run more samples.
+ */
 class SamplerMultiApp : public TransientMultiApp, public SamplerInterface
 {
 public:
   SamplerMultiApp(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+  virtual void advanceStep() override;
+  virtual bool needsRestoration() override;
+  virtual Real computeDT() override;
+
+  /**
+   * The value of a "sample_postprocessors" entry of the sub-application after running the given
+   * sample (batch mode only). Only available on the first processor after the MultiApp executed.
+   * @param sample The global sample (row) number, counting the rows of all Sampler matrices
+   * @param index The index of the postprocessor in "sample_postprocessors"
+   */
+  Real sampleResult(unsigned int sample, unsigned int index) const;
+
+  /// The Sampler providing the samples
+  Sampler & sampler() const { return _sampler; }
+
+  /// The postprocessors of the sub-application collected after each sample
+  const std::vector<PostprocessorName> & samplePostprocessors() const
+  {
+    return _sample_postprocessors;
+  }
+
 protected:
+  /// Run all samples with the app pool
+  bool solveBatch();
+
+  /**
+   * Take the next sample number from the work queue, the root of each sub-application
+   * communicator fetches it and broadcasts it to the rest of the group.
+   */
+  unsigned long nextSample(MPI_Win window);
+
+  /**
+   * Set the receivers of the pooled app to the values of the sample.
+   * @param sample The global sample (row) number
+   * @param samples The complete samples, only used without the counter generator
+   */
+  void applySample(unsigned long sample, const std::vector<DenseMatrix<Real>> & samples);
+
   /// Sampler to utilize for creating MultiApps
   Sampler & _sampler;
+
+  /// The execution mode, "normal" or "batch"
+  const MooseEnum & _mode;
+
+  /// Postprocessors of the sub-application collected after each sample in batch mode
+  const std::vector<PostprocessorName> & _sample_postprocessors;
+
+  /// Receivers of the sub-application set to the columns of each sample in batch mode
+  const std::vector<PostprocessorName> & _sample_receivers;
+
+  /// The state of each local app right after initialization (batch mode)
+  std::vector<std::shared_ptr<Backup>> _initial_backups;
+
+  /// Values of the sample postprocessors, sample major, only stored on the first processor
+  std::vector<Real> _sample_results;
 };
 
 #endif
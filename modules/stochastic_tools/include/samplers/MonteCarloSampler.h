@@ -24,6 +24,9 @@ public:
 
 protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
+  virtual std::vector<std::size_t> sampleMatrixRows() override;
+  virtual void
+  computeSampleRow(unsigned int matrix, std::size_t row, std::vector<Real> & data) override;
 
   /// Number of monte carlo samples to create for each distribution
   const std::size_t _num_samples;
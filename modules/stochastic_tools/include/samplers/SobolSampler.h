@@ -26,6 +26,9 @@ protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
   virtual void sampleSetUp() override;
   virtual void sampleTearDown() override;
+  virtual std::vector<std::size_t> sampleMatrixRows() override;
+  virtual void
+  computeSampleRow(unsigned int matrix, std::size_t row, std::vector<Real> & data) override;
 
   /// Number of Monte Carlo samples to create for each Sobol matrix
   const std::size_t _num_samples;
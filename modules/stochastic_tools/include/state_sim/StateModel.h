@@ -0,0 +1,66 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef STATEMODEL_H
+#define STATEMODEL_H
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * Discrete time Markov state model with the transition table compiled into flat arrays: the
+ * transitions out of state i are _targets[_offsets[i]] ... _targets[_offsets[i + 1] - 1], with the
+ * cumulative transition probabilities in _cumulative. The probability that is not assigned to a
+ * transition is the probability to stay in the current state, states without transitions are
+ * absorbing.
+ */
+class StateModel
+{
+public:
+  StateModel();
+
+  /**
+   * Read the transitions from a text file with one "from to probability" triplet per line, lines
+   * starting with '#' are ignored. The model is compiled afterwards.
+   */
+  void read(const std::string & file_name);
+
+  /// Add a transition, compile() must be called before the model is used
+  void addTransition(unsigned int from, unsigned int to, Real probability);
+
+  /// Build the flat transition table from the transitions added so far
+  void compile();
+
+  /// Number of states (one past the largest state id of all transitions)
+  unsigned int numStates() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+  /// Does the state have no transitions?
+  bool absorbing(unsigned int state) const { return _offsets[state] == _offsets[state + 1]; }
+
+  /**
+   * The state following the given one for the uniform random number u in [0, 1)
+   */
+  unsigned int nextState(unsigned int state, Real u) const;
+
+protected:
+  /// The transitions added since the last compile()
+  std::vector<std::tuple<unsigned int, unsigned int, Real>> _transitions;
+
+  /// Offsets of each state into _targets and _cumulative, one past the number of states in size
+  std::vector<unsigned int> _offsets;
+
+  /// The target states of all transitions
+  std::vector<unsigned int> _targets;
+
+  /// Cumulative transition probabilities within each state
+  std::vector<Real> _cumulative;
+};
+
+#endif // STATEMODEL_H
@@ -19,6 +19,9 @@ InputParameters validParams<SamplerData>();
 
 /**
  * A tool for output Sampler data.
+ *
+ * If the Sampler uses the counter generator every processor computes only its own rows and the
+ * vectors are only complete on the first processor, which writes the output.
  */
 class SamplerData : public GeneralVectorPostprocessor, SamplerInterface
 {
@@ -27,6 +30,13 @@ public:
   void virtual initialize() override;
   void virtual execute() override;
 
+protected:
+  /// Fill the vectors from the rows generated on each processor
+  void executeLocal();
+
+  /// Declare a vector for each sample matrix on the first call
+  void declareSampleVectors(std::size_t n);
+
   /// Storage for declared vectors
   std::vector<VectorPostprocessorValue *> _sample_vectors;
 
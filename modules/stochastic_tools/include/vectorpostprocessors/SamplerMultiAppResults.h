@@ -0,0 +1,44 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef SAMPLERMULTIAPPRESULTS_H
+#define SAMPLERMULTIAPPRESULTS_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+
+class SamplerMultiAppResults;
+class SamplerMultiApp;
+
+template <>
+InputParameters validParams<SamplerMultiAppResults>();
+
+/**
+ * Collects the sampled values and the "sample_postprocessors" values of each sample run by a
+ * SamplerMultiApp in batch mode, one entry per sample.  The vectors are only filled on the first
+ * processor, which holds the results gathered by the MultiApp.
+ */
+class SamplerMultiAppResults : public GeneralVectorPostprocessor
+{
+public:
+  SamplerMultiAppResults(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+
+protected:
+  /// The MultiApp running the samples, found on the first execution
+  SamplerMultiApp * _multi_app;
+
+  /// The sampled values, one vector per distribution
+  std::vector<VectorPostprocessorValue *> _sample_vectors;
+
+  /// The postprocessor values, one vector per "sample_postprocessors" entry
+  std::vector<VectorPostprocessorValue *> _result_vectors;
+};
+
+#endif
@@ -0,0 +1,65 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef STATESIMHISTORIES_H
+#define STATESIMHISTORIES_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+
+// Stochastic Tools includes
+#include "StateModel.h"
+
+class StateSimHistories;
+
+template <>
+InputParameters validParams<StateSimHistories>();
+
+/**
+ * Simulates many independent histories of a Markov state model and outputs, for every state, the
+ * fraction of the histories that end in the state and the mean number of steps the histories
+ * spend in it.
+ *
+ * The histories are split evenly across the processors and, within a processor, across threads.
+ * Every transition draws a counter based random number from the seed, the history and the step,
+ * so the results do not depend on the number of processors or threads.
+ */
+class StateSimHistories : public GeneralVectorPostprocessor
+{
+public:
+  StateSimHistories(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+protected:
+  /// The compiled transition table
+  StateModel _model;
+
+  /// Number of histories to simulate
+  const unsigned int & _histories;
+
+  /// Number of transitions in each history
+  const unsigned int & _steps;
+
+  /// The state every history starts in
+  const unsigned int & _initial_state;
+
+  /// Seed of the random numbers
+  const unsigned int & _seed;
+
+  /// The state ids
+  VectorPostprocessorValue & _state;
+
+  /// Fraction of the histories that end in each state
+  VectorPostprocessorValue & _occupancy;
+
+  /// Mean number of steps a history spends in each state
+  VectorPostprocessorValue & _residence;
+};
+
+#endif // STATESIMHISTORIES_H
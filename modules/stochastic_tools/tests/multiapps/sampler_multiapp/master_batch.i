@@ -0,0 +1,55 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Distributions]
+  [./uniform]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 7
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 10
+    distributions = 'uniform'
+    execute_on = 'initial'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[MultiApps]
+  [./runner]
+    type = SamplerMultiApp
+    sampler = sample
+    input_files = 'sub_batch.i'
+    mode = batch
+    sample_receivers = 'value'
+    sample_postprocessors = 'scaled'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./results]
+    type = SamplerMultiAppResults
+    multi_app = runner
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
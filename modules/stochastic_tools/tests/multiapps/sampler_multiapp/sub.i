@@ -37,6 +37,13 @@
   [../]
 []
 
+[Postprocessors]
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
 [Executioner]
   type = Transient
   num_steps = 20
@@ -0,0 +1,26 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Postprocessors]
+  [./value]
+    # Set to the sampled value by the master
+    type = Receiver
+  [../]
+  [./scaled]
+    type = ScalePostprocessor
+    value = value
+    scaling_factor = 2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
@@ -0,0 +1,35 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./statistics]
+    type = StateSimHistories
+    model_path = markov_model.txt
+    histories = 1000
+    steps = 20
+    seed = 7
+    execute_on = 'initial'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  execute_on = 'INITIAL'
+  csv = true
+[]
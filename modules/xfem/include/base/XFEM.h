@@ -80,7 +80,28 @@ public:
    */
   virtual void initSolution(NonlinearSystemBase & nl, AuxiliarySystem & aux);
 
-  void buildEFAMesh();
+  /**
+   * Schedule a rebuild of the EFA mesh if the mesh was changed by something else than the
+   * topology patch of update(), e.g. by adaptivity
+   */
+  virtual void meshChanged();
+
+  /**
+   * Build the given EFA mesh from scratch from the elements of the mesh
+   */
+  void buildEFAMesh(ElementFragmentAlgorithm & efa_mesh) const;
+
+  /**
+   * Update _efa_mesh around the elements that have been cut in the current step
+   */
+  void updateEFAMesh();
+
+  /**
+   * Bring the mesh up to date after elements have been cut: on a replicated mesh only the
+   * neighbor links of the new elements are set up, other meshes are prepared for use again
+   */
+  void updateMeshTopology(MeshBase & mesh);
+
   bool markCuts(Real time);
   bool markCutEdgesByGeometry(Real time);
   bool markCutEdgesByState(Real time);
@@ -164,6 +185,16 @@ public:
   bool has_secondary_cut() { return _has_secondary_cut; }
 
 private:
+  /**
+   * Add an element to the EFA mesh and restore its fragments if it has been cut before
+   */
+  EFAElement * addEFAElement(ElementFragmentAlgorithm & efa_mesh, const Elem * elem) const;
+
+  /**
+   * Compare the incrementally updated _efa_mesh with a full rebuild (used in debug builds)
+   */
+  void checkEFAMesh() const;
+
   void getFragmentEdges(const Elem * elem,
                         EFAElement2D * CEMElem,
                         std::vector<std::vector<Point>> & frag_edges) const;
@@ -202,6 +233,18 @@ private:
 
   ElementFragmentAlgorithm _efa_mesh;
 
+  /// Ids of the elements that have to be added back to _efa_mesh by updateEFAMesh()
+  std::set<unsigned int> _efa_update_elems;
+
+  /// Ids of the elements created by the current cut and of the neighbors of the deleted elements
+  std::set<dof_id_type> _topology_patch_elems;
+
+  /// Whether the last mesh change was the topology patch of update()
+  bool _topology_patched;
+
+  /// Whether _efa_mesh has to be built from scratch in the next update()
+  bool _efa_mesh_outdated;
+
   /**
    * Data structure to store the nonlinear solution for nodes/elements affected by XFEM
    * For each node/element, this is stored as a vector that contains all components
@@ -38,6 +38,7 @@ private:
   std::vector<EFAElement *> _child_elements;
   std::vector<EFAElement *> _parent_elements;
   std::map<EFANode *, std::set<EFAElement *>> _inverse_connectivity;
+  std::set<unsigned int> _marked_elements; // elements with cuts added since the last update
 
 public:
   unsigned int add2DElements(std::vector<std::vector<unsigned int>> & quads);
@@ -46,6 +47,19 @@ public:
 
   void updateEdgeNeighbors();
   void initCrackTipTopology();
+
+  /**
+   * Incremental update of the mesh after a topology update: getElementsNearCuts() gives the
+   * elements whose data may be changed by marking cuts and updating the topology, and
+   * removeElements() takes them out of the mesh together with the parent and child elements.
+   * Once the removed elements are added back (with their new ids), updateEdgeNeighbors(nodes)
+   * and updateCrackTipTopology(elems) restore the state a full rebuild would give.
+   */
+  void getElementsNearCuts(std::set<unsigned int> & elem_ids) const;
+  void removeElements(const std::set<unsigned int> & elem_ids, std::set<EFANode *> & patch_nodes);
+  void updateEdgeNeighbors(const std::set<EFANode *> & patch_nodes);
+  void updateCrackTipTopology(const std::vector<EFAElement *> & elems);
+
   void addElemEdgeIntersection(unsigned int elemid, unsigned int edgeid, double position);
   bool addFragEdgeIntersection(unsigned int elemid, unsigned int frag_edge_id, double position);
   void addElemFaceIntersection(unsigned int elemid,
@@ -75,10 +89,11 @@ public:
   const std::vector<EFAElement *> & getChildElements() { return _child_elements; };
   const std::vector<EFAElement *> & getParentElements() { return _parent_elements; };
   const std::vector<EFANode *> & getNewNodes() { return _new_nodes; };
-  const std::set<EFAElement *> & getCrackTipElements() { return _crack_tip_elements; };
+  const std::set<EFAElement *> & getCrackTipElements() const { return _crack_tip_elements; };
   const std::map<unsigned int, EFANode *> & getPermanentNodes() { return _permanent_nodes; }
   const std::map<unsigned int, EFANode *> & getTempNodes() { return _temp_nodes; }
   const std::map<unsigned int, EFANode *> & getEmbeddedNodes() { return _embedded_nodes; }
+  const std::map<unsigned int, EFAElement *> & getElements() const { return _elements; }
   EFAElement * getElemByID(unsigned int id);
   unsigned int getElemIdByNodes(unsigned int * node_id);
   void clearPotentialIsolatedNodes();
@@ -0,0 +1,97 @@
+# Benchmark for the XFEM mesh update on a larger 3D mesh cut through by a plane, run with
+#   ./xfem-opt -i stationary_jump_3d_benchmark.i
+[GlobalParams]
+  order = FIRST
+  family = LAGRANGE
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 61 # odd, so that the cut plane does not go through the nodes
+  ny = 60
+  nz = 12
+  xmin = 0.0
+  xmax = 1.0
+  ymin = 0.0
+  ymax = 1.0
+  zmin = 0.0
+  zmax = 0.25
+  elem_type = HEX8
+[]
+
+[XFEM]
+  cut_type = 'square_cut_3d' # rectangular cut plane
+  cut_data = ' 0.5 -0.001 -0.001
+               0.5  1.001 -0.001
+               0.5  1.001  1.001
+               0.5 -0.001  1.001'
+  qrule = volfrac
+  output_cut_plane = true
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Constraints]
+  [./xfem_constraint]
+    type = XFEMSingleVariableConstraint
+    variable = u
+    jump = 0.5
+    jump_flux = 0
+  [../]
+[]
+
+[BCs]
+# Define boundary conditions
+  [./left_u]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 1
+  [../]
+
+  [./right_u]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  line_search = 'none'
+
+  l_tol = 1e-3
+  nl_max_its = 15
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+
+  start_time = 0.0
+  dt = 1.0
+  end_time = 10.0
+[]
+
+[Outputs]
+  # Only the timings are of interest. The XFEM section of the performance log has the time per
+  # step of the mesh update ('update()') and of its parts ('updateEFAMesh()',
+  # 'updateMeshTopology()'); compare them with the time spent in the solve
+  execute_on = timestep_end
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
@@ -0,0 +1,88 @@
+# The diffusivity depends on the aux variable v, which is updated in every residual evaluation
+# with the average of u. The solution is u = x for any constant diffusivity, so the converged
+# diffusivity is 1 + 0.5 and the flux through the right boundary is -1.5. Values cached from the
+# first residual evaluation (u = 0) would give a flux of -1.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[AuxKernels]
+  [./v]
+    type = PostprocessorAux
+    variable = v
+    pp = average_u
+    execute_on = linear
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = GenericDiffusion
+    variable = u
+    property = diffusion
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./diffusion]
+    type = VarCouplingMaterial
+    block = 0
+    var = v
+    base = 1
+    solution_independent = true
+  [../]
+[]
+
+[Postprocessors]
+  [./average_u]
+    type = ElementAverageValue
+    variable = u
+    execute_on = 'initial linear'
+  [../]
+  [./flux]
+    type = SideFluxIntegral
+    variable = u
+    boundary = right
+    diffusivity = diffusion
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
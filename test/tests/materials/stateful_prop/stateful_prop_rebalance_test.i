@@ -0,0 +1,102 @@
+# Same problem as stateful_prop_test.i, but the mesh is repartitioned by the measured element
+# cost after every time step. The stateful properties have to follow their elements to the new
+# owners to get the same results.
+[Mesh]
+  dim = 3
+  file = cube.e
+  parallel_type = replicated
+
+  [./Partitioner]
+    type = CostWeightedPartitioner
+    imbalance_tolerance = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./prop1]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = MatDiffusion
+    variable = u
+    prop_name = thermal_conductivity
+    prop_state = 'old'                  # Use the "Old" value to compute conductivity
+  [../]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./prop1_output]
+    type = MaterialRealAux
+    variable = prop1
+    property = thermal_conductivity
+  [../]
+
+  [./prop1_output_init]
+    type = MaterialRealAux
+    variable = prop1
+    property = thermal_conductivity
+    execute_on = initial
+  [../]
+[]
+
+[BCs]
+  [./bottom]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 0.0
+  [../]
+  [./top]
+    type = DirichletBC
+    variable = u
+    boundary = 2
+    value = 1.0
+  [../]
+[]
+
+[Materials]
+  [./stateful]
+    type = StatefulTest
+    prop_names = thermal_conductivity
+    prop_values = 1.0
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementAverageValue
+    variable = prop1
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+  l_max_its = 10
+  start_time = 0.0
+  num_steps = 5
+  dt = .1
+[]
+
+[Outputs]
+  file_base = out
+  csv = true
+[]
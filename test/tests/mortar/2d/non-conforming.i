@@ -57,10 +57,12 @@
 []
 
 [BCs]
-  [./all]
+  # The left and right boundaries have no flux. Dirichlet conditions at the ends of the interface
+  # would leave the Lagrange multiplier undetermined there.
+  [./bottom_top]
     type = FunctionDirichletBC
     variable = u
-    boundary = '1 2 3 4'
+    boundary = '1 3'
     function = exact_sln
   [../]
 []
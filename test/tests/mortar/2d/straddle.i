@@ -0,0 +1,93 @@
+# The slave element (block 2) spans both master elements (block 1) of the interface, the mortar
+# line (block 1000) has a node at each master and slave node. The linear solution is exact, its
+# flux through the interface is carried by the Lagrange multiplier.
+[Mesh]
+  file = straddle.e
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./exact_sln]
+    type = ParsedFunction
+    value = y
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+
+  [./lm]
+    order = FIRST
+    family = LAGRANGE
+    block = middle
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Constraints]
+  [./ced]
+    type = EqualValueConstraint
+    variable = lm
+    interface = middle
+    master_variable = u
+  [../]
+[]
+
+[BCs]
+  # The left and right boundaries have no flux
+  [./bottom_top]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '1 3'
+    function = exact_sln
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_error]
+    type = ElementL2Error
+    variable = u
+    function = exact_sln
+    block = '1 2'
+  [../]
+  [./lm_average]
+    type = ElementAverageValue
+    variable = lm
+    block = middle
+  [../]
+[]
+
+[Preconditioning]
+  [./fmp]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  nl_rel_tol = 1e-15
+  l_tol = 1e-15
+[]
+
+[Outputs]
+  csv = true
+[]
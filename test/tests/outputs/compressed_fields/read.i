@@ -0,0 +1,113 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = -1
+  xmax = 1
+  ymin = -1
+  ymax = 1
+  nx = 4
+  ny = 4
+  # This test uses SolutionUserObject which doesn't work with DistributedMesh.
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./nodal]
+  [../]
+  [./elemental]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./elemental_exact]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[UserObjects]
+  [./fields]
+    type = SolutionUserObject
+    mesh = lossless.mcf
+  [../]
+[]
+
+[Functions]
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*t*(x*x+2*y*y)+t*x
+  [../]
+  [./nodal_fn]
+    type = SolutionFunction
+    solution = fields
+    from_variable = nodal
+  [../]
+  [./elemental_fn]
+    type = SolutionFunction
+    solution = fields
+    from_variable = elemental
+  [../]
+[]
+
+[AuxKernels]
+  [./nodal]
+    type = FunctionAux
+    variable = nodal
+    function = nodal_fn
+  [../]
+  [./elemental]
+    type = FunctionAux
+    variable = elemental
+    function = elemental_fn
+  [../]
+  # The element averages written by write.i
+  [./elemental_exact]
+    type = FunctionAux
+    variable = elemental_exact
+    function = exact_fn
+  [../]
+[]
+
+[Postprocessors]
+  # Both are zero (up to the error bound for lossy compression) when every node and element
+  # reads its own values
+  [./nodal_error]
+    type = NodalL2Error
+    variable = nodal
+    function = exact_fn
+  [../]
+  [./elemental_error]
+    type = ElementL2Difference
+    variable = elemental
+    other_variable = elemental_exact
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 4
+  solve_type = 'PJFNK'
+  [./TimeStepper]
+    type = ExodusTimeSequenceStepper
+    mesh = lossless.mcf
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
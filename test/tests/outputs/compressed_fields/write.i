@@ -0,0 +1,101 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = -1
+  xmax = 1
+  ymin = -1
+  ymax = 1
+  nx = 4
+  ny = 4
+[]
+
+[MeshModifiers]
+  # The element ids alternate between the blocks, the mesh file stores the elements by block
+  [./right_block]
+    type = SubdomainBoundingBox
+    bottom_left = '0 -1 0'
+    top_right = '1 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./nodal]
+  [../]
+  [./elemental]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*t*(x*x+2*y*y)+t*x
+  [../]
+[]
+
+[Kernels]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./nodal]
+    type = FunctionAux
+    variable = nodal
+    function = exact_fn
+  [../]
+  [./elemental]
+    type = FunctionAux
+    variable = elemental
+    function = exact_fn
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 1
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  [./lossless]
+    type = CompressedFields
+    file_base = lossless
+  [../]
+  [./lossy]
+    type = CompressedFields
+    file_base = lossy
+    compression = lossy
+    error_bound = 1e-8
+    keyframe_interval = 2
+  [../]
+[]
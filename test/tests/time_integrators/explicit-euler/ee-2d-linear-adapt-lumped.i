@@ -0,0 +1,118 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = -1
+  xmax = 1
+  ymin = -1
+  ymax = 1
+  nx = 10
+  ny = 10
+  elem_type = QUAD4
+[]
+
+[Functions]
+  [./ic]
+    type = ParsedFunction
+    value = 0
+  [../]
+
+  [./forcing_fn]
+    type = ParsedFunction
+    value = (x+y)
+  [../]
+
+  [./exact_fn]
+    type = ParsedFunction
+    value = t*(x+y)
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+
+    [./InitialCondition]
+      type = FunctionIC
+      function = ic
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+    lumping = true
+    implicit = true
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+    implicit = false
+  [../]
+
+  [./ffn]
+    type = UserForcingFunction
+    variable = u
+    function = forcing_fn
+    implicit = false
+  [../]
+[]
+
+[BCs]
+  active = 'all'
+
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '0 1 2 3'
+    function = exact_fn
+    implicit = true
+  [../]
+[]
+
+[Adaptivity]
+  steps = 1
+  marker = box
+  max_h_level = 2
+  [./Markers]
+    [./box]
+      bottom_left = '-0.4 -0.4 0'
+      inside = refine
+      top_right = '0.4 0.4 0'
+      outside = do_nothing
+      type = BoxMarker
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_err]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  [./TimeIntegrator]
+    type = ExplicitSSPRungeKutta
+    order = 1
+  [../]
+
+  start_time = 0.0
+  num_steps = 4
+  dt = 0.005
+[]
+
+[Outputs]
+  file_base = ee-2d-linear-adapt_out
+  exodus = true
+  [./console]
+    type = Console
+    max_rows = 10
+  [../]
+[]
@@ -0,0 +1,78 @@
+# Heat equation with a decaying sin(pi x) sin(pi y) mode, advanced with the lumped mass
+# explicit SSP Runge-Kutta integrator at the time step limit estimated by CFLDT
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  elem_type = QUAD4
+[]
+
+[Functions]
+  [./exact_fn]
+    type = ParsedFunction
+    value = exp(-2*pi*pi*t)*sin(pi*x)*sin(pi*y)
+  [../]
+[]
+
+[Variables]
+  [./u]
+    [./InitialCondition]
+      type = FunctionIC
+      function = exact_fn
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = DirichletBC
+    variable = u
+    boundary = 'left right top bottom'
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_err]
+    type = ElementL2Error
+    variable = u
+    function = exact_fn
+  [../]
+  [./dt]
+    type = TimestepSize
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  [./TimeIntegrator]
+    type = ExplicitSSPRungeKutta
+    order = 3
+  [../]
+  [./TimeStepper]
+    type = CFLDT
+    courant_number = 1.8
+    interval = 5
+  [../]
+
+  start_time = 0.0
+  num_steps = 20
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,64 @@
+# Benchmark of the explicit integrators on the heat equation, see the tests file for the
+# integrator specific command line arguments
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 200
+  ny = 200
+  elem_type = QUAD4
+[]
+
+[Functions]
+  [./ic]
+    type = ParsedFunction
+    value = sin(pi*x)*sin(pi*y)
+  [../]
+[]
+
+[Variables]
+  [./u]
+    [./InitialCondition]
+      type = FunctionIC
+      function = ic
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./td]
+    type = TimeDerivative
+    variable = u
+    lumping = true
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+    implicit = false
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = DirichletBC
+    variable = u
+    boundary = 'left right top bottom'
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  [./TimeIntegrator]
+    type = ExplicitTVDRK2
+  [../]
+  solve_type = 'LINEAR'
+
+  start_time = 0.0
+  num_steps = 100
+  dt = 1e-5
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
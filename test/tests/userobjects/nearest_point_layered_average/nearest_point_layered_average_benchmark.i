@@ -0,0 +1,75 @@
+# Timing benchmark for the layer reduction of NearestPointLayeredAverage
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 20
+  ny = 200
+  nz = 20
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./np_layered_average]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./np_layered_average]
+    type = SpatialUserObjectAux
+    variable = np_layered_average
+    execute_on = timestep_end
+    user_object = npla
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./one]
+    type = DirichletBC
+    variable = u
+    boundary = 'right back top'
+    value = 1
+  [../]
+[]
+
+[UserObjects]
+  [./npla]
+    type = NearestPointLayeredAverage
+    direction = y
+    points = '0.125 0 0.125 0.125 0 0.375 0.125 0 0.625 0.125 0 0.875 0.375 0 0.125 0.375 0 0.375 0.375 0 0.625 0.375 0 0.875 0.625 0 0.125 0.625 0 0.375 0.625 0 0.625 0.625 0 0.875 0.875 0 0.125 0.875 0 0.375 0.875 0 0.625 0.875 0 0.875'
+    num_layers = 10000
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
@@ -0,0 +1,59 @@
+[Mesh]
+  type = GeneratedMesh
+  parallel_type = replicated # Until RayTracing.C is fixed
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./elems]
+    type = ElementsAlongLine
+    starts = '0.05 0.05 0
+              0.15 0.95 0
+              0.95 0.45 0'
+    ends = '0.05 0.405 0
+            0.55 0.95 0
+            0.95 0.05 0'
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+[]
@@ -0,0 +1,170 @@
+# Timing benchmark for the element walk in RayTracing.C
+[Mesh]
+  type = GeneratedMesh
+  parallel_type = replicated # Until RayTracing.C is fixed
+  dim = 3
+  nx = 100
+  ny = 100
+  nz = 100
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[VectorPostprocessors]
+  # The side planes of the mesh are computed once for all of the lines
+  [./lines]
+    type = ElementsAlongLine
+    starts = '0 0 0
+              1 0 0
+              0 1 0
+              0.001 0.002 0.003
+              0.0638 0.0652 0
+              0.0638 0.1902 0
+              0.0638 0.3152 0
+              0.0638 0.4402 0
+              0.0638 0.5652 0
+              0.0638 0.6902 0
+              0.0638 0.8152 0
+              0.0638 0.9402 0
+              0.1888 0.0652 0
+              0.1888 0.1902 0
+              0.1888 0.3152 0
+              0.1888 0.4402 0
+              0.1888 0.5652 0
+              0.1888 0.6902 0
+              0.1888 0.8152 0
+              0.1888 0.9402 0
+              0.3138 0.0652 0
+              0.3138 0.1902 0
+              0.3138 0.3152 0
+              0.3138 0.4402 0
+              0.3138 0.5652 0
+              0.3138 0.6902 0
+              0.3138 0.8152 0
+              0.3138 0.9402 0
+              0.4388 0.0652 0
+              0.4388 0.1902 0
+              0.4388 0.3152 0
+              0.4388 0.4402 0
+              0.4388 0.5652 0
+              0.4388 0.6902 0
+              0.4388 0.8152 0
+              0.4388 0.9402 0
+              0.5638 0.0652 0
+              0.5638 0.1902 0
+              0.5638 0.3152 0
+              0.5638 0.4402 0
+              0.5638 0.5652 0
+              0.5638 0.6902 0
+              0.5638 0.8152 0
+              0.5638 0.9402 0
+              0.6888 0.0652 0
+              0.6888 0.1902 0
+              0.6888 0.3152 0
+              0.6888 0.4402 0
+              0.6888 0.5652 0
+              0.6888 0.6902 0
+              0.6888 0.8152 0
+              0.6888 0.9402 0
+              0.8138 0.0652 0
+              0.8138 0.1902 0
+              0.8138 0.3152 0
+              0.8138 0.4402 0
+              0.8138 0.5652 0
+              0.8138 0.6902 0
+              0.8138 0.8152 0
+              0.8138 0.9402 0
+              0.9388 0.0652 0
+              0.9388 0.1902 0
+              0.9388 0.3152 0
+              0.9388 0.4402 0
+              0.9388 0.5652 0
+              0.9388 0.6902 0
+              0.9388 0.8152 0
+              0.9388 0.9402 0'
+    ends = '1 1 1
+            0 1 1
+            1 0 1
+            0.997 0.998 0.999
+            0.9348 0.0638 1
+            0.8098 0.0638 1
+            0.6848 0.0638 1
+            0.5598 0.0638 1
+            0.4348 0.0638 1
+            0.3098 0.0638 1
+            0.1848 0.0638 1
+            0.0598 0.0638 1
+            0.9348 0.1888 1
+            0.8098 0.1888 1
+            0.6848 0.1888 1
+            0.5598 0.1888 1
+            0.4348 0.1888 1
+            0.3098 0.1888 1
+            0.1848 0.1888 1
+            0.0598 0.1888 1
+            0.9348 0.3138 1
+            0.8098 0.3138 1
+            0.6848 0.3138 1
+            0.5598 0.3138 1
+            0.4348 0.3138 1
+            0.3098 0.3138 1
+            0.1848 0.3138 1
+            0.0598 0.3138 1
+            0.9348 0.4388 1
+            0.8098 0.4388 1
+            0.6848 0.4388 1
+            0.5598 0.4388 1
+            0.4348 0.4388 1
+            0.3098 0.4388 1
+            0.1848 0.4388 1
+            0.0598 0.4388 1
+            0.9348 0.5638 1
+            0.8098 0.5638 1
+            0.6848 0.5638 1
+            0.5598 0.5638 1
+            0.4348 0.5638 1
+            0.3098 0.5638 1
+            0.1848 0.5638 1
+            0.0598 0.5638 1
+            0.9348 0.6888 1
+            0.8098 0.6888 1
+            0.6848 0.6888 1
+            0.5598 0.6888 1
+            0.4348 0.6888 1
+            0.3098 0.6888 1
+            0.1848 0.6888 1
+            0.0598 0.6888 1
+            0.9348 0.8138 1
+            0.8098 0.8138 1
+            0.6848 0.8138 1
+            0.5598 0.8138 1
+            0.4348 0.8138 1
+            0.3098 0.8138 1
+            0.1848 0.8138 1
+            0.0598 0.8138 1
+            0.9348 0.9388 1
+            0.8098 0.9388 1
+            0.6848 0.9388 1
+            0.5598 0.9388 1
+            0.4348 0.9388 1
+            0.3098 0.9388 1
+            0.1848 0.9388 1
+            0.0598 0.9388 1'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
@@ -0,0 +1,37 @@
+[Mesh]
+  type = FileMesh
+  file = distorted.e
+  parallel_type = replicated # Until RayTracing.C is fixed
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[VectorPostprocessors]
+  [./elems]
+    type = ElementsAlongLine
+    start = '0.05 0.1 0'
+    end = '0.95 0.85 0'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
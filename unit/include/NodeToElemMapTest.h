@@ -0,0 +1,81 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NODETOELEMMAPTEST_H
+#define NODETOELEMMAPTEST_H
+
+#include "gtest/gtest.h"
+
+#include "NodeToElemMap.h"
+#include "MooseUnitApp.h"
+#include "AppFactory.h"
+
+// libMesh includes
+#include "libmesh/replicated_mesh.h"
+#include "libmesh/mesh_generation.h"
+
+#include <algorithm>
+#include <map>
+
+class NodeToElemMapTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    const char * argv[2] = {"foo", "\0"};
+    _app.reset(AppFactory::createApp("MooseUnitApp", 1, (char **)argv));
+
+    _mesh = libmesh_make_unique<ReplicatedMesh>(_app->comm(), 2);
+    MeshTools::Generation::build_square(*_mesh, 8, 8, 0, 1, 0, 1, QUAD4);
+  }
+
+  /// The map as it was stored before the compressed format, from the given elements
+  std::map<dof_id_type, std::vector<dof_id_type>> referenceMap(const ConstElemRange & elems)
+  {
+    std::map<dof_id_type, std::vector<dof_id_type>> map;
+    for (const auto & elem : elems)
+      for (unsigned int n = 0; n < elem->n_nodes(); n++)
+        map[elem->node_id(n)].push_back(elem->id());
+
+    for (auto & entry : map)
+      std::sort(entry.second.begin(), entry.second.end());
+    return map;
+  }
+
+  /// Compare the lookup of all node ids with the reference
+  void compare(const NodeToElemMap & map,
+               const std::map<dof_id_type, std::vector<dof_id_type>> & reference)
+  {
+    for (dof_id_type id = 0; id < _mesh->max_node_id() + 10; ++id)
+    {
+      auto it = map.find(id);
+      auto ref_it = reference.find(id);
+      if (ref_it == reference.end())
+      {
+        EXPECT_TRUE(it == map.end()) << "node " << id;
+        continue;
+      }
+
+      ASSERT_TRUE(it != map.end()) << "node " << id;
+      EXPECT_EQ(it->first, id);
+      EXPECT_EQ(std::vector<dof_id_type>(it->second.begin(), it->second.end()), ref_it->second)
+          << "node " << id;
+    }
+  }
+
+  std::unique_ptr<MooseApp> _app;
+  std::unique_ptr<ReplicatedMesh> _mesh;
+};
+
+#endif // NODETOELEMMAPTEST_H